@@ -27,6 +27,7 @@
 
 #include <TiledArray/conversions/eigen.h>
 #include <TiledArray/dist_array.h>
+#include <algorithm>
 #include <string>
 #include <vector>
 
@@ -55,24 +56,113 @@ auto make_tile(py::buffer data) {
   return Tensor<T>(Range(shape), tmp.data());
 }
 
+template <class Array, class S = std::vector<size_t> >
+inline S shape(const Array &a) {
+  auto e = a.elements_range().extent();
+  S shape(e.size());
+  for (size_t i = 0; i < e.size(); ++i) {
+    shape[i] = e[i];
+  }
+  // std::copy(e.begin(), e.end(), shape.begin());
+  return shape;
+}
+
+template <class Array>
+inline std::vector<std::vector<int64_t> > trange(const Array &a) {
+  return trange::list(a.trange());
+}
+
 // std::function<py::buffer(const Range&)>
 template <class Array>
 void init_tiles(Array &a, py::object f) {
+  // f is called for each local tile by this thread, which holds the GIL;
+  // calling f from tasks would serialize them on the GIL
+  for (const auto index : *a.pmap()) {
+    if (a.is_zero(index)) continue;
+    py::buffer buffer = f(a.trange().make_tile_range(index));
+    a.set(index, make_tile<double>(buffer));
+  }
   py::gil_scoped_release gil;
-  auto op = [f](const Range &range) {
-    Tensor<double> tile;
-    {
-      py::gil_scoped_acquire acquire;
-      // py::print(f);
-      py::buffer buffer = f(range);
-      tile = make_tile<double>(buffer);
-    }
-    return tile;
-  };
-  a.init_tiles(op);
   a.world().gop.fence();
 }
 
+/// Visits the contiguous runs of a tile in a C-contiguous array
+
+/// \param elements The element range of the array
+/// \param range The range of the tile
+/// \param op The operation called for each run of the last mode of \p range ,
+/// with signature <tt>void op(size_t offset, size_t i, size_t n)</tt>, where
+/// \c offset and \c i are the offsets of the run in the array and in the tile,
+/// respectively, and \c n is the length of the run
+template <typename Op>
+void for_each_run(const Range &elements, const Range &range, Op &&op) {
+  const size_t rank = range.rank();
+  // rank-0 ranges have no elements
+  if (rank == 0 || range.volume() == 0) return;
+  size_t offset = 0;
+  for (size_t d = 0; d < rank; ++d) {
+    offset = offset * elements.extent(d) + range.lobound(d) -
+             elements.lobound(d);
+  }
+  std::vector<size_t> stride(rank, 1), idx(rank, 0);
+  for (size_t d = rank - 1; d > 0; --d) {
+    stride[d - 1] = stride[d] * elements.extent(d);
+  }
+  const size_t n = range.extent(rank - 1);
+  for (size_t i = 0; i < range.volume(); i += n) {
+    op(offset, i, n);
+    for (size_t d = rank - 1; d > 0;) {
+      --d;
+      ++idx[d];
+      offset += stride[d];
+      if (idx[d] < size_t(range.extent(d))) break;
+      offset -= stride[d] * range.extent(d);
+      idx[d] = 0;
+    }
+  }
+}
+
+/// Sets the local tiles of an array from a NumPy array
+
+/// \param a The array
+/// \param data The elements of the whole array; only the blocks of the
+/// local, non-zero tiles are read. \p data is converted to a C-contiguous
+/// array only if it is not one already.
+template <class Array>
+void from_numpy(Array &a, py::buffer data) {
+  typedef typename Array::scalar_type T;
+  auto elements =
+      py::array_t<T, py::array::c_style | py::array::forcecast>::ensure(data);
+  if (!elements) throw py::error_already_set();
+  const auto shape = array::shape(a);
+  if (shape.size() != size_t(elements.ndim()) ||
+      !std::equal(shape.begin(), shape.end(), elements.shape())) {
+    throw std::invalid_argument("from_numpy: shape mismatch");
+  }
+  const T *ptr = elements.data();
+  const Range &elements_range = a.trange().elements_range();
+
+  // the tiles are copied by tasks, without the GIL
+  py::gil_scoped_release gil;
+  std::vector<Future<Tensor<T> > > tiles;
+  for (const auto index : *a.pmap()) {
+    if (a.is_zero(index)) continue;
+    tiles.push_back(a.world().taskq.add(
+        [ptr, &elements_range](const Range &range) {
+          Tensor<T> tile(range);
+          for_each_run(elements_range, range,
+                       [ptr, &tile](size_t offset, size_t i, size_t n) {
+                         std::copy(ptr + offset, ptr + offset + n,
+                                   tile.data() + i);
+                       });
+          return tile;
+        },
+        a.trange().make_tile_range(index)));
+    a.set(index, tiles.back());
+  }
+  for (auto &tile : tiles) tile.get();
+}
+
 template <class Array, class... Trange>
 std::shared_ptr<Array> make_array(const Trange &... args, World *world,
                                   py::object op) {
@@ -86,22 +176,6 @@ std::shared_ptr<Array> make_array(const Trange &... args, World *world,
   return array;
 }
 
-template <class Array, class S = std::vector<size_t> >
-inline S shape(const Array &a) {
-  auto e = a.elements_range().extent();
-  S shape(e.size());
-  for (size_t i = 0; i < e.size(); ++i) {
-    shape[i] = e[i];
-  }
-  // std::copy(e.begin(), e.end(), shape.begin());
-  return shape;
-}
-
-template <class Array>
-inline std::vector<std::vector<int64_t> > trange(const Array &a) {
-  return trange::list(a.trange());
-}
-
 template <typename T>
 py::buffer_info make_buffer_info(Tensor<T> &tile) {
   std::vector<size_t> strides;
@@ -119,6 +193,22 @@ py::buffer_info make_buffer_info(Tensor<T> &tile) {
   );
 }
 
+/// Wraps a tile into a NumPy array without copying its elements
+
+/// The NumPy array owns a shallow copy of \p tile , which keeps the elements
+/// alive; changing the elements of the NumPy array changes the elements of
+/// \p tile .
+template <typename T>
+py::array_t<T> make_view(const Tensor<T> &tile) {
+  auto *owner = new Tensor<T>(tile);
+  py::capsule base(owner, [](void *p) { delete static_cast<Tensor<T> *>(p); });
+  std::vector<size_t> strides;
+  for (auto s : tile.range().stride()) {
+    strides.push_back(sizeof(T) * s);
+  }
+  return py::array_t<T>(tile.range().extent(), strides, owner->data(), base);
+}
+
 // template<class Array>
 // struct Iterator {
 //   std::shared_ptr<Array> array;
@@ -158,18 +248,68 @@ inline py::array getitem(const Array &array, Idx idx) {
     throw std::runtime_error("TArray[" + py::cast<std::string>(str) +
                              "] tile is not set");
   }
+  // a copy: the tile may be shared, e.g. by a cached remote tile or by other
+  // arrays; local_tiles() returns views of the local tiles instead
   return py::array(make_buffer_info(tile.get()));
 }
 
+/// Views of the local tiles of an array
+
+/// \param a The array
+/// \return A list of (index, tile) pairs of the local, non-zero tiles of
+/// \p a ; the tiles are views (see make_view() ) that share the elements
+/// of the tiles of \p a
+template <class Array>
+py::list local_tiles(const Array &a) {
+  std::vector<std::pair<typename Array::ordinal_type,
+                        Future<typename Array::value_type> > >
+      tiles;
+  for (const auto index : *a.pmap()) {
+    if (a.is_zero(index)) continue;
+    tiles.emplace_back(index, a.find_local(index));
+  }
+  {
+    py::gil_scoped_release gil;
+    for (auto &tile : tiles) tile.second.get();
+  }
+  py::list result;
+  for (auto &tile : tiles) {
+    auto index = a.trange().tiles_range().idx(tile.first);
+    result.append(py::make_tuple(
+        std::vector<int64_t>(index.begin(), index.end()),
+        make_view(tile.second.get())));
+  }
+  return result;
+}
+
 template <class Array>
 py::buffer_info make_buffer(Array &a) {
   typedef typename Array::scalar_type T;
   auto buffer = py::array_t<T>(shape(a));
-  for (size_t i = 0; i < a.size(); ++i) {
-    // if (a.is_zero(i)) continue;
-    auto range = range::slice(a.trange().make_tile_range(i));
-    // py::print(i,range);
-    buffer[range] = getitem(a, i);
+  T *ptr = buffer.mutable_data();
+  const Range &elements_range = a.trange().elements_range();
+  auto copy = [ptr, &elements_range](const Tensor<T> &tile) {
+    for_each_run(elements_range, tile.range(),
+                 [ptr, &tile](size_t offset, size_t i, size_t n) {
+                   std::copy(tile.data() + i, tile.data() + i + n,
+                             ptr + offset);
+                 });
+    return true;
+  };
+
+  // all tiles are requested before any is copied, and the tiles are copied
+  // by tasks, without the GIL
+  {
+    py::gil_scoped_release gil;
+    std::vector<Future<bool> > done;
+    for (size_t i = 0; i < a.size(); ++i) {
+      if (a.is_zero(i)) {
+        copy(Tensor<T>(a.trange().make_tile_range(i), T(0)));
+        continue;
+      }
+      done.push_back(a.world().taskq.add(copy, a.find(i)));
+    }
+    for (auto &d : done) d.get();
   }
   return buffer.request();
 }
@@ -211,6 +351,8 @@ void make_array_class(py::object m, const char *name) {
           .def("fill", &Array::fill, py::arg("value"),
                py::arg("skip_set") = false)
           .def("init", &array::init_tiles<Array>)
+          .def("from_numpy", &array::from_numpy<Array>, py::arg("data"))
+          .def("local_tiles", &array::local_tiles<Array>)
           // Array object needs be alive while iterator is used */
           .def("__iter__", &array::make_iterator<Array>, py::keep_alive<0, 1>())
           .def("__getitem__", &expression::getitem<Array>)
@@ -68,6 +68,10 @@ def make_test_case(Array):
       world.fence()
       #print (a[0,0])
       self.assertTrue((a[0,0] == np.ones([2,2])).all())
+      # tiles are returned as copies
+      tile = a[0,0]
+      tile[...] = 0
+      self.assertTrue((a[0,0] == np.ones([2,2])).all())
       world.fence()
 
     def test_tile_ops(self):
@@ -102,6 +106,19 @@ def make_test_case(Array):
       self.assertEqual(b.shape, a.shape)
       #print (b[...])
 
+    def test_numpy_interop(self):
+      import numpy as np
+      world = ta.get_default_world()
+      a = Array([[2,5,7],[0,3,4]], world=world)
+      data = np.arange(20.0).reshape(5,4)
+      a.from_numpy(data)
+      world.fence()
+      self.assertTrue((np.array(a) == data).all())
+      for index, tile in a.local_tiles():
+        tile[...] = 0
+      world.fence()
+      self.assertTrue((np.array(a) == 0).all())
+
   return TestCase
 
 class ArrayTest(make_test_case(ta.TArray)): pass
@@ -626,6 +626,20 @@ class ArrayImpl : public TensorImpl<Policy> {
   /// \return A const reference to this object unique id
   const madness::uniqueidT& id() const { return data_.id(); }
 
+  /// Wire compression accessor
+
+  /// \return The compression of the tiles sent to other nodes
+  const WireCompression& wire_compression() const {
+    return data_.wire_compression();
+  }
+
+  /// Set the wire compression
+
+  /// \param compression The compression of the tiles sent to other nodes
+  void set_wire_compression(const WireCompression& compression) {
+    data_.set_wire_compression(compression);
+  }
+
   static std::function<void(const ArrayImpl_&, int64_t)>&
   set_notifier_accessor() {
     static std::function<void(const ArrayImpl_&, int64_t)> value;
@@ -23,6 +23,7 @@
 #define TILEDARRAY_CONVERSIONS_CONCAT_H
 
 #include <TiledArray/dist_array.h>
+#include <TiledArray/tile_interface/shift.h>
 
 #include <vector>
 
@@ -37,6 +38,8 @@ namespace TiledArray {
 /// Concatenating multiple matrices as blocks along the diagonal is an
 /// example of concatenation along multiple (two, in this case) modes.
 /// The notion extends straightforwardly to multidimensional arrays.
+/// The tiles of the result are the tiles of \p arrays with shifted ranges,
+/// i.e. tiles are not copied unless they are owned by another process.
 /// \param arrays a sequence of DistArray objects to concatenate
 /// \param concat_modes specifies whether to concat along a mode or not
 /// \param target_world if specified, will use this work, else use
@@ -89,11 +92,57 @@ DistArray<Tile, Policy> concat(
   }
 
   TiledRange tr(tr1s);
-  DistArray<Tile, Policy> result(*target_world, tr);
-  const auto annot = detail::dummy_annotation(r);
+  DistArray<Tile, Policy> result;
+  if constexpr (is_dense_v<Policy>) {
+    result = DistArray<Tile, Policy>(*target_world, tr);
+  } else {
+    // the tiles of the arrays keep their (scaled) norms, the other tiles are
+    // zero
+    using shape_type = typename DistArray<Tile, Policy>::shape_type;
+    Tensor<typename shape_type::value_type> tile_norms(tr.tiles_range(), 0);
+    for (auto i = 0ul; i != arrays.size(); ++i) {
+      const auto& tiles = arrays[i].trange().tiles_range();
+      index tile(r);
+      for (auto&& t : tiles) {
+        for (auto mode = 0; mode != r; ++mode)
+          tile[mode] = t[mode] - tiles.lobound(mode) +
+                       tile_begin_end[i].first[mode];
+        tile_norms(tile) = arrays[i].shape()[t];
+      }
+    }
+    result = DistArray<Tile, Policy>(*target_world, tr,
+                                     shape_type(tile_norms, tr, true));
+  }
+
+  // the tiles of the arrays are moved to the result by shifting their ranges;
+  // a Tensor copy is shallow but owns its range, so its shifted copy shares
+  // the data of the argument. Other tiles are shifted by shift(), which does
+  // not modify the argument (e.g. copies of TA::Tile share their range).
   for (auto i = 0ul; i != arrays.size(); ++i) {
-    result(annot).block(tile_begin_end[i].first, tile_begin_end[i].second) =
-        arrays[i](annot);
+    const auto& arr = arrays[i];
+    const auto& tiles = arr.trange().tiles_range();
+    index tile(r), range_shift(r);
+    for (auto mode = 0; mode != r; ++mode) {
+      range_shift[mode] =
+          tr.dim(mode).tile(tile_begin_end[i].first[mode]).first -
+          arr.trange().dim(mode).tile(tiles.lobound(mode)).first;
+    }
+    for (auto&& t : tiles) {
+      for (auto mode = 0; mode != r; ++mode)
+        tile[mode] =
+            t[mode] - tiles.lobound(mode) + tile_begin_end[i].first[mode];
+      if (!result.is_local(tile) || result.is_zero(tile)) continue;
+      result.set(tile, result.world().taskq.add(
+                           [range_shift](const Tile& arg) -> Tile {
+                             if constexpr (detail::is_ta_tensor_v<Tile>) {
+                               Tile shifted = arg;
+                               shifted.shift_to(range_shift);
+                               return shifted;
+                             } else
+                               return shift(arg, range_shift);
+                           },
+                           arr.find(t)));
+    }
   }
   result.world().gop.fence();
 
@@ -30,9 +30,12 @@
 #include <TiledArray/external/eigen.h>
 #include <TiledArray/external/madness.h>
 #include <TiledArray/pmap/replicated_pmap.h>
+#include <TiledArray/pmap/user_pmap.h>
 #include <TiledArray/tensor.h>
 #include <tiledarray_fwd.h>
+#include <algorithm>
 #include <cstdint>
+#include <vector>
 #include "TiledArray/dist_array.h"
 
 namespace TiledArray {
@@ -545,6 +548,372 @@ array_to_eigen(const DistArray<Tile, Policy>& array) {
   return matrix;
 }
 
+namespace detail {
+
+/// Copy the part of an Eigen row slab that overlaps a tensor into the tensor
+
+/// \c rows holds rows <tt>[row_offset, row_offset + rows.rows())</tt> of a
+/// matrix (or of a column vector, if \c tensor is of rank 1); elements of
+/// \c tensor outside of the slab are left untouched.
+/// \tparam Derived The derived type of an Eigen matrix
+/// \tparam T A tensor type, e.g. TiledArray::Tensor
+/// \param rows The row slab
+/// \param row_offset The index of the first row of \c rows in the matrix
+/// \param tensor The tensor that will be assigned the overlap
+template <typename Derived, typename T>
+inline void eigen_rows_to_tensor(const Eigen::MatrixBase<Derived>& rows,
+                                 const std::size_t row_offset, T& tensor) {
+  const auto& range = tensor.range();
+  TA_ASSERT((range.rank() == 2u) || (range.rank() == 1u));
+  const bool is_matrix = (range.rank() == 2u);
+  const std::size_t tensor_row_begin = range.lobound_data()[0];
+  const std::size_t tensor_row_end = range.upbound_data()[0];
+  const std::size_t tensor_col_begin =
+      (is_matrix ? range.lobound_data()[1] : 0ul);
+  const std::size_t ncols = (is_matrix ? range.extent_data()[1] : 1ul);
+
+  const std::size_t row_begin = std::max(tensor_row_begin, row_offset);
+  const std::size_t row_end =
+      std::min(tensor_row_end, row_offset + std::size_t(rows.rows()));
+  if (row_begin >= row_end) return;
+  TA_ASSERT(tensor_col_begin + ncols <= std::size_t(rows.cols()));
+
+  eigen_map(tensor, range.extent_data()[0], ncols)
+      .block(row_begin - tensor_row_begin, 0, row_end - row_begin, ncols) =
+      rows.block(row_begin - row_offset, tensor_col_begin,
+                 row_end - row_begin, ncols);
+}
+
+/// Copy the part of a tensor that overlaps an Eigen row slab into the slab
+
+/// \c rows holds rows <tt>[row_offset, row_offset + rows.rows())</tt> of a
+/// matrix (or of a column vector, if \c tensor is of rank 1).
+/// \tparam T A tensor type, e.g. TiledArray::Tensor
+/// \tparam Derived The derived type of an Eigen matrix
+/// \param tensor The tensor to be copied
+/// \param rows The row slab that will be assigned the overlap
+/// \param row_offset The index of the first row of \c rows in the matrix
+template <typename T, typename Derived>
+inline void tensor_to_eigen_rows(const T& tensor,
+                                 Eigen::MatrixBase<Derived>& rows,
+                                 const std::size_t row_offset) {
+  const auto& range = tensor.range();
+  TA_ASSERT((range.rank() == 2u) || (range.rank() == 1u));
+  const bool is_matrix = (range.rank() == 2u);
+  const std::size_t tensor_row_begin = range.lobound_data()[0];
+  const std::size_t tensor_row_end = range.upbound_data()[0];
+  const std::size_t tensor_col_begin =
+      (is_matrix ? range.lobound_data()[1] : 0ul);
+  const std::size_t ncols = (is_matrix ? range.extent_data()[1] : 1ul);
+
+  const std::size_t row_begin = std::max(tensor_row_begin, row_offset);
+  const std::size_t row_end =
+      std::min(tensor_row_end, row_offset + std::size_t(rows.rows()));
+  if (row_begin >= row_end) return;
+  TA_ASSERT(tensor_col_begin + ncols <= std::size_t(rows.cols()));
+
+  rows.block(row_begin - row_offset, tensor_col_begin, row_end - row_begin,
+             ncols) = eigen_map(tensor, range.extent_data()[0], ncols)
+                          .block(row_begin - tensor_row_begin, 0,
+                                 row_end - row_begin, ncols);
+}
+
+/// Task function for copying a tensor into an Eigen row slab
+
+/// \tparam Derived The matrix type
+/// \tparam T Tensor type
+/// \param tensor The tensor to be copied
+/// \param rows The row slab to be assigned
+/// \param row_offset The index of the first row of \c rows in the matrix
+/// \param counter The task counter
+template <typename Derived, typename T>
+void counted_tensor_to_eigen_rows(const T& tensor,
+                                  Eigen::MatrixBase<Derived>* rows,
+                                  const std::size_t row_offset,
+                                  madness::AtomicInt* counter) {
+  tensor_to_eigen_rows(tensor, *rows, row_offset);
+  (*counter)++;
+}
+
+/// Task function that makes a tile from an Eigen row slab
+
+/// \tparam T Tensor type
+/// \tparam Derived The matrix type
+/// \param rows The row slab; it must cover the rows of \c range
+/// \param row_offset The index of the first row of \c rows in the matrix
+/// \param range The range of the tile
+/// \return A tile with range \c range that holds the data of \c rows
+template <typename T, typename Derived>
+T make_tile_from_eigen_rows(const Eigen::MatrixBase<Derived>* rows,
+                            const std::size_t row_offset,
+                            const typename T::range_type& range) {
+  T tensor(range);
+  eigen_rows_to_tensor(*rows, row_offset, tensor);
+  return tensor;
+}
+
+/// Task function that concatenates row blocks of a tile
+
+/// Each piece spans all columns of the tile, so in the row-major tile it
+/// occupies a contiguous chunk of memory.
+/// \tparam T Tensor type
+/// \param range The range of the tile
+/// \param pieces The row blocks of the tile, in any order
+/// \return A tile with range \c range that holds the data of \c pieces
+template <typename T>
+T concat_tile_rows(const typename T::range_type& range,
+                   const std::vector<Future<T>>& pieces) {
+  T result(range);
+  const std::size_t row_begin = range.lobound_data()[0];
+  const std::size_t ncols =
+      (range.rank() == 2u ? range.extent_data()[1] : 1ul);
+  [[maybe_unused]] std::size_t volume = 0ul;
+  for (auto&& fut_of_piece : pieces) {
+    const T& piece = fut_of_piece.get();
+    std::copy(piece.data(), piece.data() + piece.range().volume(),
+              result.data() +
+                  (piece.range().lobound_data()[0] - row_begin) * ncols);
+    volume += piece.range().volume();
+  }
+  TA_ASSERT(volume == range.volume());
+  return result;
+}
+
+}  // namespace detail
+
+// clang-format off
+/// Copy a block of rows of an Array object into an Eigen matrix object
+
+/// This is the distributed counterpart of array_to_eigen(): every rank may
+/// request a different block of rows (e.g. the rows of a row-distributed
+/// matrix of another library), and only the nonzero tiles that overlap that
+/// block are fetched, local or remote. The overlap of each tile is copied
+/// directly into the result in parallel tasks, so no rank ever holds the
+/// full matrix and \c array does not need to be replicated. This function
+/// blocks until all elements have been copied; it is not collective, but
+/// \c array must not be destroyed by the owners of the requested tiles until
+/// the copy is complete.
+/// Usage:
+/// \code
+/// TA::TArrayD array(world, trange);
+/// // Set tiles of array ...
+///
+/// // each rank gets a (possibly empty) block of rows
+/// Eigen::MatrixXd m = array_to_eigen_rows(array, offset, nrows);
+/// \endcode
+/// \tparam Tile The array tile type
+/// \tparam EigenStorageOrder The storage order of the resulting Eigen::Matrix
+///      object; the default is Eigen::ColMajor, i.e. the column-major storage
+/// \param array The array to be converted
+/// \param row_offset The index of the first row to be copied
+/// \param nrows The number of rows to be copied
+/// \return an \c nrows by \c n Eigen matrix that holds rows
+/// <tt>[row_offset, row_offset + nrows)</tt> of \c array , where \c n is the
+/// number of columns of \c array (1 if \c array is of rank 1)
+/// \throw TiledArray::Exception When the number
+/// of dimensions of \c array is not equal to 1 or 2.
+/// \throw TiledArray::Exception When the rows are outside of \c array .
+// clang-format on
+template <typename Tile, typename Policy,
+          unsigned int EigenStorageOrder = Eigen::ColMajor>
+Eigen::Matrix<typename Tile::value_type, Eigen::Dynamic, Eigen::Dynamic,
+              EigenStorageOrder>
+array_to_eigen_rows(const DistArray<Tile, Policy>& array,
+                    const std::size_t row_offset, const std::size_t nrows) {
+  typedef Eigen::Matrix<typename Tile::value_type, Eigen::Dynamic,
+                        Eigen::Dynamic, EigenStorageOrder>
+      EigenMatrix;
+
+  const auto rank = array.trange().tiles_range().rank();
+  TA_ASSERT(((rank == 2u) || (rank == 1u)) &&
+            "TiledArray::array_to_eigen_rows(): The array dimensions must be "
+            "equal to 1 or 2.");
+
+  const auto* MADNESS_RESTRICT const array_extent =
+      array.trange().elements_range().extent_data();
+  TA_ASSERT(row_offset + nrows <= std::size_t(array_extent[0]) &&
+            "TiledArray::array_to_eigen_rows(): The rows must be in the "
+            "range of the array.");
+  // if array is sparse must initialize to zero
+  EigenMatrix rows =
+      EigenMatrix::Zero(nrows, (rank == 2 ? array_extent[1] : 1));
+  if (nrows == 0ul) return rows;
+
+  // Only the tile rows that overlap the slab need to be visited
+  const auto& rows_trange = array.trange().dim(0);
+  const std::size_t first = rows_trange.element_to_tile(row_offset);
+  const std::size_t last =
+      rows_trange.element_to_tile(row_offset + nrows - 1ul) + 1ul;
+  const std::size_t ncol_tiles =
+      (rank == 2 ? array.trange().dim(1).tile_extent() : 1ul);
+
+  // Spawn tasks to copy array tiles to the Eigen matrix
+  madness::AtomicInt counter;
+  counter = 0;
+  int n = 0;
+  for (std::size_t i = first * ncol_tiles; i < last * ncol_tiles; ++i) {
+    if (!array.is_zero(i)) {
+      array.world().taskq.add(
+          &detail::counted_tensor_to_eigen_rows<
+              EigenMatrix, typename DistArray<Tile, Policy>::value_type>,
+          array.find(i), &rows, row_offset, &counter);
+      ++n;
+    }
+  }
+
+  // Wait until the above tasks are complete. Tasks will be processed by this
+  // thread while waiting.
+  array.world().await([&counter, n]() { return counter == n; });
+
+  return rows;
+}
+
+// clang-format off
+/// Convert a row-distributed Eigen matrix into an Array object
+
+/// This is the distributed counterpart of eigen_to_array(): instead of a
+/// full copy of the matrix, each rank provides a contiguous block of rows,
+/// \c rows , which starts at row \c row_offset ; the blocks of all ranks must
+/// cover the matrix without overlap (a block may be empty). Each rank copies
+/// its rows, in parallel tasks, directly into the pieces of the result tiles
+/// it holds, and the pieces are then sent straight to the owners of the
+/// result tiles, which concatenate them; the pieces of a tile are contiguous
+/// in the tile, so no element is copied more than once per rank and no
+/// transposition is performed for either storage order of \c rows . This
+/// function is collective and blocks until the result is complete.
+///
+/// Usage:
+/// \code
+/// // this rank holds rows [offset, offset + m.rows()) of a 100x100 matrix
+/// Eigen::MatrixXd m(nrows, 100);
+/// // Fill m with data ...
+///
+/// auto array = eigen_rows_to_array<TA::TArrayD>(world, trange, m, offset);
+/// \endcode
+/// \tparam A The array type
+/// \tparam Derived The Eigen matrix derived type
+/// \param world The world where the array will live
+/// \param trange The tiled range of the new array
+/// \param rows The block of rows of the matrix held by this rank (a column
+/// vector, if \c trange is of rank 1)
+/// \param row_offset The index of the first row of \c rows in the matrix
+/// \param pmap the process map object of the result [default=null];
+/// initialized to the default if null
+/// \return An \c Array object that is a copy of the distributed matrix
+/// \throw TiledArray::Exception When the blocks of rows do not tile the rows
+/// of \c trange , or \c rows does not have as many columns as \c trange .
+// clang-format on
+template <typename A, typename Derived>
+A eigen_rows_to_array(World& world, const typename A::trange_type& trange,
+                      const Eigen::MatrixBase<Derived>& rows,
+                      const std::size_t row_offset,
+                      std::shared_ptr<typename A::pmap_interface> pmap = {}) {
+  typedef typename A::value_type value_type;
+  typedef DistArray<value_type, DensePolicy> pieces_type;
+
+  const auto rank = trange.tiles_range().rank();
+  TA_ASSERT((rank == 1 || rank == 2) &&
+            "TiledArray::eigen_rows_to_array(): The number of dimensions in "
+            "trange must be equal to 1 or 2.");
+  const std::size_t m = trange.elements_range().extent_data()[0];
+  TA_ASSERT(std::size_t(rows.cols()) ==
+                (rank == 2 ? std::size_t(trange.elements_range().extent(1))
+                           : 1ul) &&
+            "TiledArray::eigen_rows_to_array(): The number of columns in "
+            "trange is not equal to the number of columns in the Eigen "
+            "matrix.");
+
+  // Gather the row blocks of all ranks
+  const std::size_t nproc = world.size();
+  std::vector<std::size_t> slabs(2ul * nproc, 0ul);
+  slabs[2ul * world.rank()] = row_offset;
+  slabs[2ul * world.rank() + 1ul] = rows.rows();
+  world.gop.sum(slabs.data(), slabs.size());
+
+  // (first row, rank) of each nonempty row block, in row order
+  std::vector<std::pair<std::size_t, std::size_t>> slab_begin;
+  for (std::size_t r = 0ul; r < nproc; ++r)
+    if (slabs[2ul * r + 1ul] != 0ul) slab_begin.emplace_back(slabs[2ul * r], r);
+  std::sort(slab_begin.begin(), slab_begin.end());
+  {
+    [[maybe_unused]] std::size_t next = 0ul;
+    for (auto&& s : slab_begin) {
+      TA_ASSERT(s.first == next &&
+                "TiledArray::eigen_rows_to_array(): The row blocks must "
+                "cover the matrix without overlap.");
+      next += slabs[2ul * s.second + 1ul];
+    }
+    TA_ASSERT(next == m &&
+              "TiledArray::eigen_rows_to_array(): The row blocks must "
+              "cover the matrix without overlap.");
+  }
+
+  // Split the tile rows at the row block boundaries; each piece lives on the
+  // rank that holds its rows
+  std::vector<std::size_t> hashmarks;
+  const auto& rows_trange = trange.dim(0);
+  for (auto&& tile : rows_trange) hashmarks.push_back(tile.first);
+  hashmarks.push_back(m);
+  for (auto&& s : slab_begin) hashmarks.push_back(s.first);
+  std::sort(hashmarks.begin(), hashmarks.end());
+  hashmarks.erase(std::unique(hashmarks.begin(), hashmarks.end()),
+                  hashmarks.end());
+  const TiledRange1 pieces_trange1(hashmarks.begin(), hashmarks.end());
+  std::vector<std::size_t> piece_owner(pieces_trange1.tile_extent());
+  for (std::size_t p = 0ul; p < piece_owner.size(); ++p) {
+    const auto it =
+        std::upper_bound(slab_begin.begin(), slab_begin.end(),
+                         std::make_pair(hashmarks[p], nproc));
+    TA_ASSERT(it != slab_begin.begin());
+    piece_owner[p] = std::prev(it)->second;
+  }
+  const std::size_t ncol_tiles =
+      (rank == 2 ? trange.dim(1).tile_extent() : 1ul);
+  const typename A::trange_type pieces_trange =
+      (rank == 2 ? TiledRange({pieces_trange1, trange.dim(1)})
+                 : TiledRange({pieces_trange1}));
+  auto pieces_pmap = std::make_shared<detail::UserPmap>(
+      world, pieces_trange.tiles_range().volume(),
+      [piece_owner, ncol_tiles](std::size_t i) {
+        return piece_owner[i / ncol_tiles];
+      });
+  pieces_type pieces(world, pieces_trange, pieces_pmap);
+
+  // Spawn tasks to copy the local rows to the pieces
+  for (std::size_t i = 0; i < pieces.size(); ++i) {
+    if (pieces.is_local(i))
+      pieces.set(i, world.taskq.add(
+                        &detail::make_tile_from_eigen_rows<value_type, Derived>,
+                        &rows, row_offset, pieces_trange.make_tile_range(i)));
+  }
+
+  // Spawn tasks to concatenate the pieces of the local tiles
+  A array = (pmap ? A(world, trange, pmap) : A(world, trange));
+  for (std::size_t i = 0; i < array.size(); ++i) {
+    if (!array.is_local(i)) continue;
+    const auto& tile_rows = rows_trange.tile(i / ncol_tiles);
+    std::vector<Future<value_type>> tile_pieces;
+    if (tile_rows.second > tile_rows.first) {
+      const std::size_t first = pieces_trange1.element_to_tile(tile_rows.first);
+      const std::size_t last =
+          pieces_trange1.element_to_tile(tile_rows.second - 1ul) + 1ul;
+      tile_pieces.reserve(last - first);
+      for (std::size_t p = first; p < last; ++p)
+        tile_pieces.push_back(pieces.find(p * ncol_tiles + i % ncol_tiles));
+    }
+    array.set(i, world.taskq.add(&detail::concat_tile_rows<value_type>,
+                                 array.trange().make_tile_range(i),
+                                 std::move(tile_pieces)));
+  }
+
+  // keep rows and pieces around until everyone is done
+  world.gop.fence();
+
+  array.truncate();
+
+  return array;
+}
+
 /// Convert a row-major matrix buffer into an Array object
 
 /// This function will copy the content of \c buffer into an \c Array object
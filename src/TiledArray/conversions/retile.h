@@ -22,16 +22,21 @@
 #ifndef TILEDARRAY_RETILE_H
 #define TILEDARRAY_RETILE_H
 
+#include "TiledArray/dist_array.h"
 #include "TiledArray/util/annotation.h"
-#include "TiledArray/special/diagonal_array.h"
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
 
 /// \name Retile function
 /// \brief Retiles a tensor with a provided TiledRange
 
 /// Retiles the data of the input tensor by comparing each dimension of its
-/// TiledRange with the corresponding dimension of the input TiledRange. If they
-/// are not equivalent, a suitably tiled identity matrix is used to convert that
-/// dimension to the desired tiling.
+/// TiledRange with the corresponding dimension of the input TiledRange. Each
+/// tile of the output tensor is assembled directly from the blocks of the
+/// tiles of the input tensor that it overlaps (i.e. no identity matrices are
+/// contracted with the input tensor).
 /// \param tensor The tensor whose data is to be retiled
 /// \param new_trange The desired TiledRange of the output tensor
 /// \return A new tensor with appropriately tiled data
@@ -45,44 +50,73 @@ auto retile(const DistArray<TileType, PolicyType>& tensor,
   auto rank = new_trange.rank();
   auto tensor_rank = tensor.trange().rank();
   assert((rank == tensor_rank) && "TiledRanges are of different ranks");
+  TA_ASSERT(new_trange.elements_range() == tensor.trange().elements_range());
 
-  // Makes the annotations for the contraction step
-  auto annotations =
-      [&](std::size_t target_dim) -> std::tuple<std::string, std::string> {
-    std::ostringstream final, switcher;
-    switcher << "i" << target_dim << ",iX";
-    if (target_dim == 0) {
-      final << "iX";
-    } else {
-      final << "i0";
-    }
-    for (unsigned int d = 1; d < rank; ++d) {
-      if (d == target_dim) {
-        final << ",iX";
-      } else {
-        final << ",i" << d;
-      }
+  using tensor_type = DistArray<TileType, PolicyType>;
+  const auto& trange = tensor.trange();
+  if (new_trange == trange) {
+    const auto start = detail::dummy_annotation(rank);
+    tensor_type output_tensor;
+    output_tensor(start) = tensor(start);
+    return output_tensor;
+  }
+
+  // The range of the input tiles that overlap an output tile
+  auto input_tiles = [&](const Range& range) {
+    Range::index_type lo(rank), up(rank);
+    for (unsigned int d = 0; d < rank; ++d) {
+      lo[d] = trange.dim(d).element_to_tile(range.lobound(d));
+      up[d] = trange.dim(d).element_to_tile(range.upbound(d) - 1) + 1;
     }
-    return {final.str(), switcher.str()};
+    return Range(lo, up);
   };
 
-  // Check the different dimensions and contract when needed
-  using tensor_type = DistArray<TileType, PolicyType>;
-  auto start = detail::dummy_annotation(rank);
   tensor_type output_tensor;
-  for (auto i = 0; i < rank; ++i) {
-    if (i == 0) { output_tensor(start) = tensor(start); }
-    if (new_trange.dim(i) != tensor.trange().dim(i)) {
-      // Make identity for contraction
-      TiledRange retiler{tensor.trange().dim(i), new_trange.dim(i)};
-      auto identity = diagonal_array<tensor_type>(tensor.world(), retiler);
-
-      // Make indices for contraction
-      auto [finish, change] = annotations(i);
+  if constexpr (is_dense_v<PolicyType>) {
+    output_tensor = tensor_type(tensor.world(), new_trange);
+  } else {
+    // The norm of an output tile is bounded by the norms of the input tiles
+    // that it overlaps
+    using shape_type = typename tensor_type::shape_type;
+    Tensor<typename shape_type::value_type> tile_norms(
+        new_trange.tiles_range());
+    for (auto&& idx : new_trange.tiles_range()) {
+      typename shape_type::value_type norm2 = 0;
+      for (auto&& t : input_tiles(new_trange.make_tile_range(idx))) {
+        const auto norm =
+            tensor.shape()[t] * trange.make_tile_range(t).volume();
+        norm2 += norm * norm;
+      }
+      tile_norms(idx) = std::sqrt(norm2);
+    }
+    output_tensor = tensor_type(tensor.world(), new_trange,
+                                shape_type(tile_norms, new_trange));
+  }
 
-      // Retile
-      output_tensor(finish) = output_tensor(start) * identity(change);
+  for (auto&& ord : *output_tensor.pmap()) {
+    if (output_tensor.is_zero(ord)) continue;
+    auto range = new_trange.make_tile_range(ord);
+    std::vector<Future<TileType>> tiles;
+    for (auto&& t : input_tiles(range)) {
+      if (!tensor.is_zero(t)) tiles.push_back(tensor.find(t));
     }
+    auto op = [](const Range& range,
+                 const std::vector<Future<TileType>>& tiles) {
+      TileType result(range, typename TileType::value_type{});
+      for (auto&& fut : tiles) {
+        const auto& tile = fut.get();
+        // Copy the block of tile that overlaps result
+        Range::index_type lo(range.rank()), up(range.rank());
+        for (unsigned int d = 0; d < range.rank(); ++d) {
+          lo[d] = std::max(range.lobound(d), tile.range().lobound(d));
+          up[d] = std::min(range.upbound(d), tile.range().upbound(d));
+        }
+        for (auto&& idx : Range(lo, up)) result(idx) = tile(idx);
+      }
+      return result;
+    };
+    output_tensor.set(ord, tensor.world().taskq.add(op, std::move(range),
+                                                    std::move(tiles)));
   }
 
   return output_tensor;
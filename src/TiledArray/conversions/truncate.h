@@ -80,6 +80,48 @@ inline std::enable_if_t<!is_dense_v<Policy>, void> truncate(
         [previous_thresh] { Policy::shape_type::threshold(previous_thresh); });
 }
 
+/// Truncate a dense Array in place
+
+/// This is a no-op
+/// \tparam Tile The tile type of \c array
+/// \tparam Policy The policy type of \c array
+/// \param[in,out] array The array object to be truncated
+template <typename Tile, typename Policy>
+inline std::enable_if_t<is_dense_v<Policy>, void> truncate_inplace(
+    DistArray<Tile, Policy>& array,
+    typename Policy::shape_type::value_type = 0) {}
+
+/// Truncate a sparse Array in place
+
+/// Unlike truncate(), the tile norms are not recomputed: the tiles whose
+/// norms in the current shape of \p array are below \p thresh are dropped,
+/// the shape is updated without communication, and the surviving tiles are
+/// shared with (not copied to) the truncated array.
+/// \tparam Tile The tile type of \c array
+/// \tparam Policy The policy type of \c array
+/// \param[in,out] array The array object to be truncated
+/// \param[in] thresh The threshold below which the tiles are considered to be
+/// zero
+/// \warning The shape of \p array must be up to date with its tiles, i.e.
+/// the tiles must not have been modified in place since the shape was
+/// computed; otherwise use truncate()
+/// \note This is a collective operation
+template <typename Tile, typename Policy>
+inline std::enable_if_t<!is_dense_v<Policy>, void> truncate_inplace(
+    DistArray<Tile, Policy>& array,
+    typename Policy::shape_type::value_type thresh =
+        Policy::shape_type::threshold()) {
+  TA_ASSERT(thresh >= 0);
+  DistArray<Tile, Policy> result(array.world(), array.trange(),
+                                 array.shape().truncate(thresh),
+                                 array.pmap());
+  for (auto ord : *(array.pmap())) {
+    if (result.is_zero(ord)) continue;
+    result.set(ord, array.find_local(ord));
+  }
+  array = result;
+}
+
 }  // namespace TiledArray
 
 #endif  // TILEDARRAY_CONVERSIONS_TRUNCATE_H__INCLUDED
@@ -514,6 +514,170 @@ void split_tilewise_fused_array(
   return;
 }
 
+/// @brief a batch of DistArray objects with the same TiledRange, viewed as a
+/// single array with 1 more dimension
+
+/// The leading dimension of the fused view is the batch dimension and is
+/// blocked by 1, i.e. tile @c (v,t...) of the fused view is tile @c t of the
+/// @c v -th member. Hence the tiles of the fused view share the data of the
+/// tiles of the members, and the fused view has the same distribution as the
+/// members: neither constructing the fused view nor splitting a fused array
+/// into a batch moves or copies data. Batched operations over the members
+/// are expressed as a single expression over the fused view, e.g.
+/// @code
+/// ArrayBatch<TA::TArrayD> c(arrays);
+/// TA::TArrayD r;
+/// r("k,i,j") = c("k,i,l") * b("l,j");
+/// ArrayBatch<TA::TArrayD> rs(r);  // rs[k] shares the tiles of r
+/// @endcode
+/// @tparam Array a DistArray type with TiledArray::Tensor tiles
+template <typename Array>
+class ArrayBatch {
+ public:
+  using Tile = typename Array::value_type;
+  using Policy = typename Array::policy_type;
+  using shape_type = typename Array::shape_type;
+  static_assert(detail::is_ta_tensor_v<Tile>,
+                "ArrayBatch requires TiledArray::Tensor tiles");
+
+  ArrayBatch() = default;
+
+  /// @param[in] arrays the members of the batch; every element of @c arrays
+  /// must have the same TiledRange and live in the same world
+  explicit ArrayBatch(std::vector<Array> arrays) : arrays_(std::move(arrays)) {
+    TA_ASSERT(!arrays_.empty());
+    for (auto&& array : arrays_) {
+      TA_ASSERT(array.trange() == arrays_.front().trange());
+      TA_ASSERT(&array.world() == &arrays_.front().world());
+    }
+  }
+
+  /// splits a fused array into a batch
+
+  /// @param[in] fused an array whose leading dimension is blocked by 1, e.g.
+  /// the result of an expression over the fused view of a batch; the members
+  /// of the batch share the tiles of @c fused
+  explicit ArrayBatch(const Array& fused) : fused_(fused) {
+    const auto& trange = fused.trange();
+    TA_ASSERT(trange.rank() > 1);
+    TA_ASSERT(trange.dim(0).tile_extent() == trange.dim(0).extent());
+    auto tr1s = trange.data();
+    tr1s.erase(tr1s.begin());
+    const TiledRange split_trange(tr1s.begin(), tr1s.end());
+    const auto& tiles_range = split_trange.tiles_range();
+    const std::size_t ntiles = tiles_range.volume();
+
+    arrays_.reserve(trange.dim(0).extent());
+    for (std::size_t v = 0; v != trange.dim(0).extent(); ++v) {
+      const std::size_t offset = v * ntiles;
+      Array array(fused.world(), split_trange,
+                  detail::tilewise_slice_of_fused_shape(
+                      split_trange, fused.shape(), v, ntiles, 1),
+                  slice_pmap(fused.world(), fused.pmap(), offset, ntiles));
+      for (auto&& ord : *array.pmap()) {
+        if (array.is_zero(ord)) continue;
+        array.set(ord, fused.world().taskq.add(
+                           [](const Range& range, const Tile& tile) {
+                             return tile.reshape(range);
+                           },
+                           split_trange.make_tile_range(ord),
+                           fused.find_local(offset + ord)));
+      }
+      arrays_.emplace_back(std::move(array));
+    }
+  }
+
+  /// @return the number of members of this batch
+  std::size_t size() const { return arrays_.size(); }
+
+  /// @param[in] v the index of a member
+  /// @return the @c v -th member of this batch
+  const Array& operator[](std::size_t v) const { return arrays_.at(v); }
+
+  /// @return the members of this batch
+  const std::vector<Array>& arrays() const { return arrays_; }
+
+  /// @return the fused view of this batch; it is constructed on first use,
+  /// which must be collective
+  const Array& fused() const {
+    if (!fused_.is_initialized() && !arrays_.empty()) fused_ = make_fused();
+    return fused_;
+  }
+
+  /// @param[in] annotation the annotation of the fused view, with the batch
+  /// index first
+  /// @return the annotated fused view of this batch, for use in expressions
+  auto operator()(const std::string& annotation) const {
+    return fused()(annotation);
+  }
+
+ private:
+  std::vector<Array> arrays_;  ///< the members of this batch
+  mutable Array fused_;        ///< the fused view of @c arrays_
+
+  /// @return the process map of a contiguous range of tiles of @c pmap
+  static std::shared_ptr<const Pmap> slice_pmap(
+      World& world, const std::shared_ptr<const Pmap>& pmap,
+      const std::size_t offset, const std::size_t ntiles) {
+    if (pmap->is_replicated())
+      return std::make_shared<detail::ReplicatedPmap>(world, ntiles);
+    return std::make_shared<detail::UserPmap>(
+        world, ntiles,
+        [pmap, offset](std::size_t i) { return pmap->owner(offset + i); });
+  }
+
+  Array make_fused() const {
+    const auto& first = arrays_.front();
+    World& world = first.world();
+    const std::size_t narrays = arrays_.size();
+    const auto fused_trange = detail::prepend_dim_to_trange(
+        narrays, first.trange(), narrays, 1, 0);
+    const auto& tiles_range = first.trange().tiles_range();
+    const std::size_t ntiles = tiles_range.volume();
+
+    // tile (v,t) is owned by the owner of tile t of the v-th member
+    std::shared_ptr<const Pmap> pmap;
+    if (first.pmap()->is_replicated()) {
+      pmap = std::make_shared<detail::ReplicatedPmap>(world, narrays * ntiles);
+    } else {
+      std::vector<ProcessID> owners(narrays * ntiles);
+      for (std::size_t v = 0; v != narrays; ++v)
+        for (std::size_t t = 0; t != ntiles; ++t)
+          owners[v * ntiles + t] = arrays_[v].owner(t);
+      pmap = std::make_shared<detail::UserPmap>(
+          world, owners.size(),
+          [owners = std::move(owners)](std::size_t i) { return owners[i]; });
+    }
+
+    Array fused;
+    if constexpr (is_dense_v<Policy>) {
+      fused = Array(world, fused_trange, pmap);
+    } else {
+      // the fused tiles have the volumes of the member tiles, hence the
+      // same scaled norms
+      Tensor<typename shape_type::value_type> tile_norms(
+          fused_trange.tiles_range());
+      for (std::size_t v = 0; v != narrays; ++v)
+        std::copy_n(arrays_[v].shape().data().data(), ntiles,
+                    tile_norms.data() + v * ntiles);
+      fused =
+          Array(world, fused_trange, shape_type(tile_norms, fused_trange, true),
+                pmap);
+    }
+
+    for (auto&& ord : *fused.pmap()) {
+      if (fused.is_zero(ord)) continue;
+      fused.set(ord, world.taskq.add(
+                         [](const Range& range, const Tile& tile) {
+                           return tile.reshape(range);
+                         },
+                         fused_trange.make_tile_range(ord),
+                         arrays_[ord / ntiles].find_local(ord % ntiles)));
+    }
+    return fused;
+  }
+};
+
 }  // namespace TiledArray
 
 #endif  // TILEDARRAY_CONVERSIONS_VECTOR_OF_ARRAYS_H_
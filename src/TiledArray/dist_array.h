@@ -27,7 +27,9 @@
 #include "TiledArray/conversions/truncate.h"
 #include "TiledArray/pmap/replicated_pmap.h"
 #include "TiledArray/policies/dense_policy.h"
+#include "TiledArray/node_replicator.h"
 #include "TiledArray/replicator.h"
+#include "TiledArray/tensor/type_traits.h"
 #include "TiledArray/tile_interface/cast.h"
 #include "TiledArray/util/annotation.h"
 #include "TiledArray/util/initializer_list.h"
@@ -49,6 +51,20 @@ class Tensor;
 template <typename T, typename P>
 DistArray<T, P> replicated(const DistArray<T, P>& a);
 
+/// Convert a distributed array into an array replicated once per node
+/// \throw TiledArray::Exception if the PIMPL is not initialized.
+template <typename T, typename P>
+DistArray<T, P> node_replicated(const DistArray<T, P>& a);
+
+/// Redistribute a distributed array according to a new process map
+/// \throw TiledArray::Exception if the PIMPL is not initialized.
+/// Strong throw guarantee.
+template <typename T, typename P>
+DistArray<T, P> redistributed(
+    const DistArray<T, P>& a,
+    const std::shared_ptr<const typename DistArray<T, P>::pmap_interface>&
+        pmap);
+
 /// A (multidimensional) tiled array
 
 /// DistArray is the local representation of a global object. This means that
@@ -1139,6 +1155,31 @@ class DistArray : public madness::archive::ParallelSerializableObject {
     return impl_ref().pmap();
   }
 
+  /// Wire compression accessor
+
+  /// \return The compression of the tiles of this array that are sent to
+  /// other nodes
+  /// \throw TiledArray::Exception if the PIMPL is not initialized. Strong
+  ///                              throw guarantee.
+  const WireCompression& wire_compression() const {
+    return impl_ref().wire_compression();
+  }
+
+  /// Set the wire compression
+
+  /// The tiles of this array are compressed as specified by \p compression
+  /// when they are fetched by other nodes with find(), and when they are
+  /// broadcast by contractions that use this array as an argument. This
+  /// must be set to the same value on all nodes; it is kept when this array
+  /// is assigned the result of an expression.
+  /// \param compression The compression setting, e.g.
+  /// <tt>WireCompression::lossless()</tt>
+  /// \throw TiledArray::Exception if the PIMPL is not initialized. Strong
+  ///                              throw guarantee.
+  void set_wire_compression(const WireCompression& compression) {
+    impl_ref().set_wire_compression(compression);
+  }
+
   /// Check dense/sparse
 
   /// \return \c true when \c Array is dense, \c false otherwise.
@@ -1297,6 +1338,30 @@ class DistArray : public madness::archive::ParallelSerializableObject {
   ///                              guarantee.
   void make_replicated() { DistArray::operator=(replicated(*this)); }
 
+  /// Convert a distributed array into an array replicated once per node
+
+  /// \throw TiledArray::Exception if the PIMPL is not initialized.
+  /// \note This is a collective operation
+  /// \sa node_replicated
+  void make_node_replicated() {
+    DistArray::operator=(node_replicated(*this));
+  }
+
+  /// Change the distribution of the array tiles
+
+  /// Tiles that stay on this process are shared with the new distribution
+  /// without copying, tiles whose owner changes are sent to their new owner
+  /// as soon as they are available.
+  /// \param pmap The new tile index -> process map, e.g. a
+  ///        detail::WeightedBlockedPmap built from measured per-tile costs
+  /// \throw TiledArray::Exception if the PIMPL is not initialized. Strong throw
+  ///                              guarantee.
+  /// \note This is a collective operation
+  /// \sa redistributed
+  void rebalance(const std::shared_ptr<const pmap_interface>& pmap) {
+    DistArray::operator=(redistributed(*this, pmap));
+  }
+
   /// Update shape data and remove tiles that are below the zero threshold
   /// \param[in] thresh the threshold below which the tiles are considered
   ///        to be zero (only for sparse arrays will such tiles be discarded)
@@ -1309,6 +1374,21 @@ class DistArray : public madness::archive::ParallelSerializableObject {
     TiledArray::truncate(*this, thresh);
   }
 
+  /// Remove tiles whose current shape norms are below the zero threshold
+
+  /// Unlike truncate(), tile norms are not recomputed and the surviving tiles
+  /// are shared with the truncated array
+  /// \param[in] thresh the threshold below which the tiles are considered
+  ///        to be zero (only for sparse arrays will such tiles be discarded)
+  /// \sa TiledArray::truncate_inplace
+
+  /// \note This is a collective operation
+  /// \note This function is a no-op for dense arrays.
+  void truncate_inplace(
+      typename shape_type::value_type thresh = shape_type::threshold()) {
+    TiledArray::truncate_inplace(*this, thresh);
+  }
+
   /// Check if the array is initialized
 
   /// \return \c false if the array has been default initialized, otherwise
@@ -1838,6 +1918,138 @@ DistArray<T, P> replicated(const DistArray<T, P>& a) {
   return result;
 }
 
+/// Convert a distributed array into an array replicated once per node
+
+/// Like replicated(), every rank holds all tiles of the result, but the
+/// ranks of a shared-memory node share one read-only copy of the tiles,
+/// which is stored in a POSIX shared memory segment; hence the memory used
+/// per node does not grow with the number of ranks per node. The tiles are
+/// laid out by the node of their owner, so the tiles of each node are
+/// contiguous: the ranks copy their local tiles to the segment of their
+/// node, the node leaders exchange the segments (one inter-node transfer
+/// per node), and the other ranks of a node read them from shared memory.
+/// Arrays whose tiles are not TiledArray::Tensor objects with numeric
+/// elements are replicated by replicated(), as are all arrays if the shared
+/// memory of a node cannot hold the tiles.
+/// \param a The array to be replicated
+/// \return The replicated array
+/// \warning The tiles of the result are shared by the ranks of a node and
+/// are mapped read-only; they must not be modified in place.
+/// \note This is a collective operation; it waits for the local tiles of
+/// \p a , and the result is complete upon return.
+template <typename T, typename P>
+DistArray<T, P> node_replicated(const DistArray<T, P>& a) {
+  auto& world = a.world();
+
+  if constexpr (!detail::is_ta_tensor_v<T>) {
+    return replicated(a);
+  } else if constexpr (!detail::is_numeric_v<typename T::value_type>) {
+    return replicated(a);
+  } else {
+    if (a.pmap()->is_replicated() || (world.size() == 1)) {
+      return a;
+    }
+
+    typedef typename T::value_type value_type;
+    const auto& trange = a.trange();
+    detail::NodeTopology topology(world);
+
+    // Lay out the non-zero tiles by the node of their owner
+    std::vector<std::vector<std::size_t>> node_tiles(topology.nnodes());
+    for (std::size_t ord = 0ul; ord < a.size(); ++ord)
+      if (!a.is_zero(ord))
+        node_tiles[topology.node_of(a.owner(ord))].push_back(ord);
+    std::vector<std::size_t> offset(a.size(), 0ul);
+    std::vector<std::size_t> node_begin(1, 0ul);
+    for (const auto& tiles : node_tiles) {
+      std::size_t n = node_begin.back();
+      for (const auto ord : tiles) {
+        offset[ord] = n;
+        n += trange.make_tile_range(ord).volume() * sizeof(value_type);
+      }
+      node_begin.push_back(n);
+    }
+
+    auto memory =
+        std::make_shared<detail::NodeSharedMemory>(topology, node_begin.back());
+    // Fall back to replicated() if the segment of a node could not be
+    // created, e.g. for lack of shared memory
+    bool is_mapped = (memory->data() != nullptr);
+    world.gop.logic_and(&is_mapped, 1);
+    if (!is_mapped) return replicated(a);
+    auto* base = static_cast<unsigned char*>(memory->data());
+
+    // Copy the local tiles to the segment of this node, then exchange the
+    // segments among the nodes
+    for (const auto ord : *a.pmap()) {
+      if (a.is_zero(ord)) continue;
+      const T tile = a.find_local(ord).get();
+      TA_ASSERT(tile.batch_size() == 1ul);
+      std::copy(tile.data(), tile.data() + tile.size(),
+                reinterpret_cast<value_type*>(base + offset[ord]));
+    }
+    topology.node_comm().Barrier();
+    detail::allgather_node_segments(topology, base, node_begin);
+    topology.node_comm().Barrier();
+    memory->protect();
+
+    auto pmap = std::make_shared<detail::ReplicatedPmap>(world, a.size());
+    DistArray<T, P> result(world, trange, a.shape(), pmap);
+    for (std::size_t ord = 0ul; ord < a.size(); ++ord) {
+      if (a.is_zero(ord)) continue;
+      result.set(ord, T(trange.make_tile_range(ord), 1ul,
+                        std::shared_ptr<value_type>(
+                            memory, reinterpret_cast<value_type*>(
+                                        base + offset[ord]))));
+    }
+    return result;
+  }
+}
+
+/// Redistribute a distributed array according to a new process map
+
+/// Local tiles whose owner is unchanged are shared with the result (no copy,
+/// no communication); only the tiles whose owner changes are moved, each one
+/// asynchronously, as soon as it has been assigned in \p a .
+/// \param a The array to be redistributed
+/// \param pmap The tile index -> process map of the result
+/// \return An array with the same tiles as \p a , distributed by \p pmap
+/// \note This is a collective operation; the tiles are in transit until the
+///       next fence.
+template <typename T, typename P>
+DistArray<T, P> redistributed(
+    const DistArray<T, P>& a,
+    const std::shared_ptr<const typename DistArray<T, P>::pmap_interface>&
+        pmap) {
+  if (a.pmap() == pmap) return a;
+
+  DistArray<T, P> result(a.world(), a.trange(), a.shape(), pmap);
+
+  // Every process holds all tiles of a replicated array, so unless \p a is
+  // replicated too the local tiles are broadcast, as by replicated()
+  if (pmap->is_replicated() && !a.pmap()->is_replicated() &&
+      a.world().size() > 1) {
+    auto replicator =
+        std::make_shared<detail::Replicator<DistArray<T, P>>>(a, result);
+    TA_ASSERT(replicator.unique());  // Required for deferred_cleanup
+    madness::detail::deferred_cleanup(a.world(), replicator);
+    return result;
+  }
+
+  // Hand each local tile to its new owner, tiles that stay on this process
+  // share the future, others are sent when the future is assigned. Every
+  // process holds all tiles of a replicated array, so then only the tiles
+  // that become local are kept.
+  const bool is_replicated = a.pmap()->is_replicated();
+  for (const auto ord : *a.pmap()) {
+    if (a.is_zero(ord)) continue;
+    if (is_replicated && !pmap->is_local(ord)) continue;
+    result.set(ord, a.find_local(ord));
+  }
+
+  return result;
+}
+
 }  // namespace TiledArray
 
 // serialization
@@ -567,18 +567,55 @@ class Summa
     get_vector(right_, begin, end, right_stride_local_, row);
   }
 
+  /// Broadcast a tile of \c arg
+
+  /// If \c arg requests wire compression (see DistEval::wire_compression()
+  /// ), the root encodes the tile, which is forwarded in its wire format,
+  /// and decoded by a task on each receiving process.
+  /// \param[in] arg The argument that owns the tile
+  /// \param[in] key The broadcast key
+  /// \param[in,out] tile The tile; it is set by the broadcast on the
+  /// processes other than \c group_root
+  /// \param[in] group_root The root process of the broadcast
+  /// \param[in] group The process group where the tile will be broadcast
+  template <typename Arg, typename T>
+  void bcast_tile(const Arg& arg, const madness::DistributedID& key,
+                  Future<T>& tile, const ProcessID group_root,
+                  const madness::Group& group) const {
+    World& world = TensorImpl_::world();
+    const WireCompression compression = arg.wire_compression();
+    if (!compression) {
+      world.gop.bcast(key, tile, group_root, group);
+      return;
+    }
+
+    typedef TiledArray::detail::WireTile<T> wire_type;
+    Future<wire_type> wire;
+    const bool is_root = (group.rank() == group_root);
+    if (is_root)
+      wire = world.taskq.add(
+          [compression](const T& t) { return wire_type(t, compression); },
+          tile);
+    world.gop.bcast(key, wire, group_root, group);
+    if (!is_root)
+      tile.set(world.taskq.add([](const wire_type& w) { return w.tile(); },
+                               wire));
+  }
+
   /// Broadcast tiles from \c arg
 
+  /// \param[in] arg The argument that owns the tiles
   /// \param[in] start The index of the first tile to be broadcast
   /// \param[in] stride The stride between tile indices to be broadcast
   /// \param[in] group The process group where the tiles will be broadcast
   /// \param[in] group_root The root process of the broadcast
   /// \param[in] key_offset The broadcast key offset value
   /// \param[out] vec The vector that will hold broadcast tiles
-  template <typename Datum>
-  void bcast(const ordinal_type start, const ordinal_type stride,
-             const madness::Group& group, const ProcessID group_root,
-             const ordinal_type key_offset, std::vector<Datum>& vec) const {
+  template <typename Arg, typename Datum>
+  void bcast(const Arg& arg, const ordinal_type start,
+             const ordinal_type stride, const madness::Group& group,
+             const ProcessID group_root, const ordinal_type key_offset,
+             std::vector<Datum>& vec) const {
     TA_ASSERT(vec.size() != 0ul);
     TA_ASSERT(group.size() > 0);
     TA_ASSERT(group_root < group.size());
@@ -601,7 +638,7 @@ class Summa
 
       // Broadcast the tile
       const madness::DistributedID key(DistEvalImpl_::id(), index + key_offset);
-      TensorImpl_::world().gop.bcast(key, it->second, group_root, group);
+      bcast_tile(arg, key, it->second, group_root, group);
 
 #ifdef TILEDARRAY_ENABLE_SUMMA_TRACE_BCAST
       ss << index << " ";
@@ -652,8 +689,8 @@ class Summa
     if (!row_group.empty()) {
       // Broadcast column k of left_.
       ProcessID group_root = get_row_group_root(k, row_group);
-      bcast(left_start_local_ + k, left_stride_local_, row_group, group_root,
-            0ul, col);
+      bcast(left_, left_start_local_ + k, left_stride_local_, row_group,
+            group_root, 0ul, col);
     }
   }
 
@@ -669,8 +706,8 @@ class Summa
       ProcessID group_root = get_col_group_root(k, col_group);
 
       // Broadcast row k of right_.
-      bcast(k * proc_grid_.cols() + proc_grid_.rank_col(), right_stride_local_,
-            col_group, group_root, left_.size(), row);
+      bcast(right_, k * proc_grid_.cols() + proc_grid_.rank_col(),
+            right_stride_local_, col_group, group_root, left_.size(), row);
     }
   }
 
@@ -706,7 +743,7 @@ class Summa
           // Broadcast the tile
           const madness::DistributedID key(DistEvalImpl_::id(), index);
           auto tile = get_tile(left_, index);
-          TensorImpl_::world().gop.bcast(key, tile, group_root, row_group);
+          bcast_tile(left_, key, tile, group_root, row_group);
         } else {
           // Discard the tile
           left_.discard(index);
@@ -750,7 +787,7 @@ class Summa
           const madness::DistributedID key(DistEvalImpl_::id(),
                                            index + left_.size());
           auto tile = get_tile(right_, index);
-          TensorImpl_::world().gop.bcast(key, tile, group_root, col_group);
+          bcast_tile(right_, key, tile, group_root, col_group);
         } else {
           // Discard the tile
           right_.discard(index);
@@ -24,7 +24,9 @@
 #include <TiledArray/perm_index.h>
 #include <TiledArray/permutation.h>
 #include <TiledArray/tensor_impl.h>
+#include <TiledArray/tile_op/tile_interface.h>
 #include <TiledArray/type_traits.h>
+#include <TiledArray/util/wire_compression.h>
 #ifdef TILEDARRAY_HAS_CUDA
 #include <TiledArray/cuda/cuda_task_fn.h>
 #include <TiledArray/external/cuda.h>
@@ -60,6 +62,12 @@ class DistEvalImpl : public TensorImpl<Policy>,
   typedef Tile value_type;  ///< Tile type
   typedef typename eval_trait<value_type>::type
       eval_type;  ///< Tile evaluation type
+  typedef typename shape_type::value_type norm_type;  ///< Tile norm type
+
+  /// \c true if the norms of the tiles can be recorded as they are set
+  static constexpr bool can_record_tile_norms =
+      !is_lazy_tile<value_type>::value &&
+      has_member_function_norm_anyreturn_v<const value_type>;
 
  private:
   madness::uniqueidT id_;       ///< Globally unique object identifier.
@@ -77,6 +85,23 @@ class DistEvalImpl : public TensorImpl<Policy>,
   volatile int task_count_;         ///< Total number of local tasks
   madness::AtomicInt set_counter_;  ///< The number of tiles set by this node
 
+  /// The norms of the tiles set by this node, if they are recorded
+  std::shared_ptr<Tensor<norm_type>> tile_norms_;
+
+  /// The compression of the tiles of this evaluator that are broadcast
+  WireCompression wire_compression_;
+
+  /// Record the norm of a tile set by this node
+
+  /// \param i The index in the result space of the tile
+  /// \param tile The tile
+  void record_tile_norm(ordinal_type i, const value_type& tile) {
+    if constexpr (can_record_tile_norms) {
+      // each tile is set once, so the elements are written by distinct tasks
+      (*tile_norms_)[i] = static_cast<norm_type>(TiledArray::norm(tile));
+    }
+  }
+
  protected:
   /// Permute \c index from a source index to a target index
 
@@ -114,7 +139,8 @@ class DistEvalImpl : public TensorImpl<Policy>,
         source_to_target_(),
         target_to_source_(),
         task_count_(-1),
-        set_counter_() {
+        set_counter_(),
+        tile_norms_() {
     set_counter_ = 0;
 
     if (perm) {
@@ -145,6 +171,44 @@ class DistEvalImpl : public TensorImpl<Policy>,
   /// \param i The index of the tile
   virtual void discard_tile(ordinal_type i) const = 0;
 
+  /// Record the norms of the tiles set by this node
+
+  /// The norm of each tile is computed by the task that sets it, i.e. right
+  /// after the tile is produced; those of tiles set with a future are
+  /// computed by a task that runs as soon as the tile is ready. Must be called
+  /// before eval(), and requires \c can_record_tile_norms .
+  void record_tile_norms() {
+    static_assert(can_record_tile_norms,
+                  "the norms of the tiles of this evaluator can not be "
+                  "recorded");
+    TA_ASSERT(task_count_ == -1);
+    tile_norms_ = std::make_shared<Tensor<norm_type>>(
+        TensorImpl_::trange().tiles_range(), norm_type(0));
+  }
+
+  /// Recorded tile norms accessor
+
+  /// \return The norms of the tiles set by this node, indexed by the tile
+  /// ordinals in the result space, or null if the norms are not recorded
+  /// \note The norms are complete only after wait()
+  const std::shared_ptr<Tensor<norm_type>>& tile_norms() const {
+    return tile_norms_;
+  }
+
+  /// Wire compression accessor
+
+  /// \return The compression of the tiles of this evaluator that are
+  /// broadcast to other nodes by the evaluators that consume them
+  const WireCompression& wire_compression() const { return wire_compression_; }
+
+  /// Set the wire compression
+
+  /// \param compression The compression of the tiles of this evaluator that
+  /// are broadcast to other nodes
+  void set_wire_compression(const WireCompression& compression) {
+    wire_compression_ = compression;
+  }
+
   /// Set tensor value
 
   /// This will store \c value at ordinal index \c i . Typically, this
@@ -152,6 +216,8 @@ class DistEvalImpl : public TensorImpl<Policy>,
   /// \param i The index in the result space where value will be stored
   /// \param value The value to be stored at index \c i
   void set_tile(ordinal_type i, const value_type& value) {
+    if (tile_norms_) record_tile_norm(i, value);
+
     // Store value
     madness::DistributedID id(id_, i);
     TensorImpl_::world().gop.send(TensorImpl_::owner(i), id, value);
@@ -172,7 +238,15 @@ class DistEvalImpl : public TensorImpl<Policy>,
     TensorImpl_::world().gop.send(TensorImpl_::owner(i), id, f);
 
     // Record the assignment of a tile
-    f.register_callback(this);
+    if (tile_norms_) {
+      TensorImpl_::world().taskq.add(
+          [this, i](const value_type& tile) {
+            record_tile_norm(i, tile);
+            DistEvalImpl_::notify();
+          },
+          f);
+    } else
+      f.register_callback(this);
   }
 
   /// Tile set notification
@@ -259,6 +333,7 @@ class DistEval {
       pmap_interface;  ///< Process map interface type
   typedef typename impl_type::value_type value_type;  ///< Tile type
   typedef typename impl_type::eval_type eval_type;    ///< Tile evaluation type
+  typedef typename impl_type::norm_type norm_type;    ///< Tile norm type
   typedef Future<value_type> future;                  ///< Future of tile type
 
  private:
@@ -298,6 +373,25 @@ class DistEval {
   /// this object).
   void eval() { pimpl_->eval(); }
 
+  /// Record the norms of the tiles set by this node
+
+  /// \sa DistEvalImpl::record_tile_norms()
+  void record_tile_norms() { pimpl_->record_tile_norms(); }
+
+  /// Recorded tile norms accessor
+
+  /// \sa DistEvalImpl::tile_norms()
+  const std::shared_ptr<Tensor<norm_type>>& tile_norms() const {
+    return pimpl_->tile_norms();
+  }
+
+  /// Wire compression accessor
+
+  /// \sa DistEvalImpl::wire_compression()
+  const WireCompression& wire_compression() const {
+    return pimpl_->wire_compression();
+  }
+
   /// Tensor tile size array accessor
 
   /// \return The size array of the tensor tiles
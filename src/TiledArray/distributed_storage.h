@@ -21,6 +21,7 @@
 #define TILEDARRAY_DISTRIBUTED_STORAGE_H__INCLUDED
 
 #include <TiledArray/pmap/pmap.h>
+#include <TiledArray/util/wire_compression.h>
 
 namespace TiledArray {
 namespace detail {
@@ -64,8 +65,9 @@ class DistributedStorage : public madness::WorldObject<DistributedStorage<T> > {
                               ///< stored by this container
   std::shared_ptr<const pmap_interface>
       pmap_;  ///< The process map that defines the element distribution
-  mutable container_type data_;     ///< The local data container
-  madness::AtomicInt num_live_ds_;  ///< Number of live DelayedSet objects
+  mutable container_type data_;       ///< The local data container
+  madness::AtomicInt num_live_ds_;    ///< Number of live DelayedSet objects
+  WireCompression wire_compression_;  ///< Compression of remote elements
 
   // not allowed
   DistributedStorage(const DistributedStorage_&);
@@ -89,6 +91,19 @@ class DistributedStorage : public madness::WorldObject<DistributedStorage<T> > {
     remote_f.set(f);
   }
 
+  void get_wire_handler(
+      const size_type i, const WireCompression& compression,
+      const typename Future<detail::WireTile<value_type>>::remote_refT& ref)
+      const {
+    const future& f = get_local(i);
+    Future<detail::WireTile<value_type>> remote_f(ref);
+    remote_f.set(get_world().taskq.add(
+        [compression](const value_type& value) {
+          return detail::WireTile<value_type>(value, compression);
+        },
+        f));
+  }
+
   template <typename Value>
   std::enable_if_t<std::is_same_v<std::decay_t<Value>, value_type> ||
                        std::is_same_v<std::decay_t<Value>, future>,
@@ -165,6 +180,21 @@ class DistributedStorage : public madness::WorldObject<DistributedStorage<T> > {
   /// \throw nothing
   const std::shared_ptr<const pmap_interface>& pmap() const { return pmap_; }
 
+  /// Wire compression accessor
+
+  /// \return The compression of the elements fetched from other nodes
+  const WireCompression& wire_compression() const { return wire_compression_; }
+
+  /// Set the wire compression
+
+  /// Elements fetched by get() from other nodes are compressed by their
+  /// owner as specified by \p compression ; must be set to the same value
+  /// on all nodes.
+  /// \param compression The compression setting
+  void set_wire_compression(const WireCompression& compression) {
+    wire_compression_ = compression;
+  }
+
   /// Element owner
 
   /// \return The process that owns element \c i
@@ -213,6 +243,16 @@ class DistributedStorage : public madness::WorldObject<DistributedStorage<T> > {
       return get_local(i);
     } else {
       // Send a request to the owner of i for the element.
+      if (wire_compression_) {
+        // The owner compresses the element, which is decoded here
+        Future<detail::WireTile<value_type>> wire;
+        WorldObject_::task(owner(i), &DistributedStorage_::get_wire_handler,
+                           i, wire_compression_, wire.remote_ref(get_world()),
+                           madness::TaskAttributes::hipri());
+        return get_world().taskq.add(
+            [](const detail::WireTile<value_type>& w) { return w.tile(); },
+            wire);
+      }
       future result;
       WorldObject_::task(owner(i), &DistributedStorage_::get_handler, i,
                          result.remote_ref(get_world()),
@@ -4,8 +4,11 @@
 #include "TiledArray/dist_array.h"
 #include "TiledArray/einsum/index.h"
 #include "TiledArray/einsum/range.h"
+#include "TiledArray/expressions/expr.h"
 #include "TiledArray/expressions/fwd.h"
 #include "TiledArray/fwd.h"
+#include "TiledArray/pmap/replicated_pmap.h"
+#include "TiledArray/pmap/user_pmap.h"
 #include "TiledArray/tiled_range.h"
 #include "TiledArray/tiled_range1.h"
 
@@ -64,6 +67,144 @@ struct ArrayTerm {
   }
 };
 
+/// Permutes the modes of a range
+
+/// \param p A permutation
+/// \param data A pointer to the extents or strides of a range
+/// \param rank The rank of the range
+/// \return The first \p rank elements of \p data , permuted by \p p
+template <typename T>
+std::vector<size_t> permuted(const Permutation &p, const T *data,
+                             const size_t rank) {
+  if (!p) return std::vector<size_t>(data, data + rank);
+  const auto result = p * data;
+  return std::vector<size_t>(result.begin(), result.end());
+}
+
+/// Accumulates the batched dot product of two tiles
+
+/// The modes of \p a and \p b , permuted by \p pa and \p pb respectively,
+/// are the same; the leading \p nbatch permuted modes are batch (Hadamard)
+/// modes and the remaining modes are contracted. The permutations are fused
+/// into the dot product, i.e. the tiles are not permuted.
+/// \param[in] a The first tile
+/// \param[in] pa The permutation of the modes of \p a
+/// \param[in] b The second tile
+/// \param[in] pb The permutation of the modes of \p b
+/// \param[in] nbatch The number of batch modes
+/// \param[in,out] result The dot product of batch \c k is added to
+/// <tt>result[k]</tt>
+template <typename Tensor>
+void batched_dot(const Tensor &a, const Permutation &pa, const Tensor &b,
+                 const Permutation &pb, const size_t nbatch,
+                 typename Tensor::value_type *result) {
+  typedef typename Tensor::value_type value_type;
+  const size_t rank = a.range().rank();
+  TA_ASSERT(nbatch < rank);
+  const auto sa = permuted(pa, a.range().stride_data(), rank);
+  const auto sb = permuted(pb, b.range().stride_data(), rank);
+  const auto extent = permuted(pa, a.range().extent_data(), rank);
+
+  // the volume of a batch, and the innermost (contracted) mode
+  size_t volume = 1;
+  for (size_t d = nbatch; d < rank; ++d) volume *= extent[d];
+  const size_t inner = extent[rank - 1];
+  const size_t ia = sa[rank - 1];
+  const size_t ib = sb[rank - 1];
+
+  const value_type *MADNESS_RESTRICT const a_data = a.data();
+  const value_type *MADNESS_RESTRICT const b_data = b.data();
+  std::vector<size_t> idx(rank, 0);
+  size_t oa = 0, ob = 0;
+  const size_t outer = a.range().volume() / inner;
+  for (size_t o = 0; o < outer; ++o) {
+    value_type sum(0);
+    if (ia == 1 && ib == 1) {
+      for (size_t n = 0; n < inner; ++n) sum += a_data[oa + n] * b_data[ob + n];
+    } else {
+      for (size_t n = 0; n < inner; ++n)
+        sum += a_data[oa + n * ia] * b_data[ob + n * ib];
+    }
+    result[o * inner / volume] += sum;
+
+    // advance to the next run of the innermost mode
+    for (size_t d = rank - 1; d > 0;) {
+      --d;
+      ++idx[d];
+      oa += sa[d];
+      ob += sb[d];
+      if (idx[d] < extent[d]) break;
+      oa -= sa[d] * extent[d];
+      ob -= sb[d] * extent[d];
+      idx[d] = 0;
+    }
+  }
+}
+
+/// Constructs the slice of a term for a tile of the Hadamard indices
+
+/// Tile \c ei of the slice is tile <tt>h+ei</tt> of the term, permuted and
+/// reshaped to a batch of \p batch tiles. The slice is constructed without
+/// communication: its tiles are owned by the owners of the corresponding
+/// tiles of the term and its shape is taken from the shape of the term.
+/// \param world The world of the slice
+/// \param term The term
+/// \param h The tile of the Hadamard indices
+/// \param batch The batch size of the tiles of the slice
+/// \return The slice
+template <typename Array>
+Array make_slice(World &world, const ArrayTerm<Array> &term,
+                 const Einsum::Index<size_t> &h, size_t batch) {
+  using Tensor = typename Array::value_type;
+  using Shape = typename Array::shape_type;
+  const Permutation &P = term.permutation;
+  const auto &tiles_range = term.ei_tiled_range.tiles_range();
+
+  std::shared_ptr<typename Array::pmap_interface> pmap;
+  if (term.array.pmap()->is_replicated()) {
+    pmap = std::make_shared<detail::ReplicatedPmap>(world,
+                                                    tiles_range.volume());
+  } else {
+    std::vector<ProcessID> owners(tiles_range.volume());
+    for (Einsum::Index<size_t> ei : term.tiles) {
+      owners[tiles_range.ordinal(ei)] =
+          term.array.owner(apply_inverse(P, h + ei));
+    }
+    pmap = std::make_shared<detail::UserPmap>(
+        world, owners.size(),
+        [owners = std::move(owners)](size_t i) { return owners[i]; });
+  }
+
+  Array slice;
+  if constexpr (Shape::is_dense()) {
+    slice = Array(world, term.ei_tiled_range, pmap);
+  } else {
+    TiledArray::Tensor<typename Shape::value_type> tile_norms(tiles_range);
+    for (Einsum::Index<size_t> ei : term.tiles) {
+      auto idx = apply_inverse(P, h + ei);
+      tile_norms[tiles_range.ordinal(ei)] =
+          term.array.shape()[term.array.trange().tiles_range().ordinal(idx)] *
+          term.array.trange().tile(idx).volume();
+    }
+    slice = Array(world, term.ei_tiled_range,
+                  Shape(tile_norms, term.ei_tiled_range), pmap);
+  }
+
+  for (Einsum::Index<size_t> ei : term.tiles) {
+    auto idx = apply_inverse(P, h + ei);
+    if (!term.array.is_local(idx)) continue;
+    if (term.array.is_zero(idx) || slice.is_zero(ei)) continue;
+    auto shape = term.ei_tiled_range.tile(ei);
+    slice.set(ei, world.taskq.add(
+                      [P, shape, batch](const Tensor &tile) {
+                        Tensor result = P ? tile.permute(P) : tile;
+                        return result.reshape(shape, batch);
+                      },
+                      term.array.find_local(idx)));
+  }
+  return slice;
+}
+
 template <typename Array_, typename... Indices>
 auto einsum(expressions::TsrExpr<Array_> A, expressions::TsrExpr<Array_> B,
             std::tuple<Einsum::Index<std::string>, Indices...> cs,
@@ -150,42 +291,47 @@ auto einsum(expressions::TsrExpr<Array_> A, expressions::TsrExpr<Array_> B,
     TA_ASSERT(e);
   } else if (!e) {  // hadamard reduction
     auto &[A, B] = AB;
-    TiledRange trange(range_map[i]);
     RangeProduct tiles;
     for (auto idx : i) {
       tiles *= Range(range_map[idx].tiles_range());
     }
     auto pa = A.permutation;
     auto pb = B.permutation;
+    auto pc = C.permutation;
+    const size_t nh = h.size();
     for (Index h : H.tiles) {
       if (!C.array.is_local(h)) continue;
       size_t batch = 1;
       for (size_t i = 0; i < h.size(); ++i) {
         batch *= H.batch[i].at(h[i]);
       }
-      Tensor tile(TiledArray::Range{batch}, typename Tensor::value_type(0));
+      // the tiles of A and B are requested up front, so that remote tiles
+      // are fetched while other result tiles are computed
+      std::vector<Future<Tensor>> a_tiles, b_tiles;
       for (Index i : tiles) {
         // skip this unless both input tiles exist
         const auto pahi_inv = apply_inverse(pa, h + i);
         const auto pbhi_inv = apply_inverse(pb, h + i);
         if (A.array.is_zero(pahi_inv) || B.array.is_zero(pbhi_inv)) continue;
-
-        auto ai = A.array.find(pahi_inv).get();
-        auto bi = B.array.find(pbhi_inv).get();
-        if (pa) ai = ai.permute(pa);
-        if (pb) bi = bi.permute(pb);
-        auto shape = trange.tile(i);
-        ai = ai.reshape(shape, batch);
-        bi = bi.reshape(shape, batch);
-        for (size_t k = 0; k < batch; ++k) {
-          auto hk = ai.batch(k).dot(bi.batch(k));
-          tile({k}) += hk;
-        }
+        a_tiles.push_back(A.array.find(pahi_inv));
+        b_tiles.push_back(B.array.find(pbhi_inv));
       }
-      auto pc = C.permutation;
       auto shape = apply_inverse(pc, C.array.trange().tile(h));
-      tile = tile.reshape(shape);
-      if (pc) tile = tile.permute(pc);
+      auto tile = world.taskq.add(
+          [pa, pb, pc, nh, batch, shape](
+              const std::vector<Future<Tensor>> &a_tiles,
+              const std::vector<Future<Tensor>> &b_tiles) {
+            Tensor tile(TiledArray::Range{batch},
+                        typename Tensor::value_type(0));
+            for (size_t n = 0; n < a_tiles.size(); ++n) {
+              batched_dot(a_tiles[n].get(), pa, b_tiles[n].get(), pb, nh,
+                          tile.data());
+            }
+            tile = tile.reshape(shape);
+            if (pc) tile = tile.permute(pc);
+            return tile;
+          },
+          a_tiles, b_tiles);
       C.array.set(h, tile);
     }
     return C.array;
@@ -201,65 +347,56 @@ auto einsum(expressions::TsrExpr<Array_> A, expressions::TsrExpr<Array_> B,
     }
   }
 
-  std::vector<std::shared_ptr<World>> worlds;
-  std::vector<std::tuple<Index, Tensor>> local_tiles;
+  // the slices of all Hadamard tiles are evaluated concurrently, as a single
+  // distributed computation on world. Only their evaluations hold the slices
+  // of A and B, so these are released as soon as the contraction of their
+  // slice is done; then a task takes over the local tiles of the result
+  // slice, which is released too
+  using SliceTiles = std::vector<std::tuple<Index, Tensor>>;
+  std::vector<Future<SliceTiles>> slice_tiles;
 
   // iterates over tiles of hadamard indices
   for (Index h : H.tiles) {
     auto &[A, B] = AB;
-    auto own = A.own(h) || B.own(h);
-    auto comm = world.mpi.comm().Split(own, world.rank());
-    worlds.push_back(std::make_unique<World>(comm));
-    auto &owners = worlds.back();
-    if (!own) continue;
     size_t batch = 1;
     for (size_t i = 0; i < h.size(); ++i) {
       batch *= H.batch[i].at(h[i]);
     }
-    for (auto &term : AB) {
-      term.local_tiles.clear();
-      const Permutation &P = term.permutation;
+    Array ei[3];
+    ei[0] = make_slice(world, A, h, batch);
+    ei[1] = make_slice(world, B, h, batch);
+    Future<Array> done = ei[2](C.expr).assign_async(
+        (ei[0](A.expr) * ei[1](B.expr)).set_world(world));
+    slice_tiles.push_back(world.taskq.add(
+        [h, batch, &C](const Array &slice) {
+          SliceTiles tiles;
+          for (Index e : C.tiles) {
+            if (!slice.is_local(e)) continue;
+            if (slice.is_zero(e)) continue;
+            auto tile = slice.find_local(e).get();
+            assert(tile.batch_size() == batch);
+            const Permutation &P = C.permutation;
+            auto c = apply(P, h + e);
+            auto shape = C.array.trange().tile(c);
+            shape = apply_inverse(P, shape);
+            tile = tile.reshape(shape);
+            if (P) tile = tile.permute(P);
+            tiles.push_back({c, tile});
+          }
+          return tiles;
+        },
+        done));
+  }
 
-      for (Index ei : term.tiles) {
-        auto idx = apply_inverse(P, h + ei);
-        if (!term.array.is_local(idx)) continue;
-        if (term.array.is_zero(idx)) continue;
-        // TODO no need for immediate evaluation
-        auto tile = term.array.find_local(idx).get();
-        if (P) tile = tile.permute(P);
-        auto shape = term.ei_tiled_range.tile(ei);
-        tile = tile.reshape(shape, batch);
-        term.local_tiles.push_back({ei, tile});
-      }
-      bool replicated = term.array.pmap()->is_replicated();
-      term.ei = TiledArray::make_array<Array>(
-          *owners, term.ei_tiled_range, term.local_tiles.begin(),
-          term.local_tiles.end(), replicated);
-    }
-    C.ei(C.expr) = (A.ei(A.expr) * B.ei(B.expr)).set_world(*owners);
-    A.ei.defer_deleter_to_next_fence();
-    B.ei.defer_deleter_to_next_fence();
-    A.ei = Array();
-    B.ei = Array();
-    // why omitting this fence leads to deadlock?
-    owners->gop.fence();
-    for (Index e : C.tiles) {
-      if (!C.ei.is_local(e)) continue;
-      if (C.ei.is_zero(e)) continue;
-      // TODO no need for immediate evaluation
-      auto tile = C.ei.find_local(e).get();
-      assert(tile.batch_size() == batch);
-      const Permutation &P = C.permutation;
-      auto c = apply(P, h + e);
-      auto shape = C.array.trange().tile(c);
-      shape = apply_inverse(P, shape);
-      tile = tile.reshape(shape);
-      if (P) tile = tile.permute(P);
-      local_tiles.push_back({c, tile});
+  std::vector<std::tuple<Index, Tensor>> local_tiles;
+  {
+    // the tasks executed while waiting do not join a deferred batch
+    detail::SuspendDeferral suspend;
+    for (auto &tiles : slice_tiles) {
+      for (auto &tile : tiles.get()) local_tiles.push_back(std::move(tile));
     }
-    // mark for lazy deletion
-    C.ei = Array();
   }
+  slice_tiles.clear();
 
   if constexpr (!Shape::is_dense()) {
     TiledRange tiled_range = TiledRange(range_map[c]);
@@ -276,9 +413,7 @@ auto einsum(expressions::TsrExpr<Array_> A, expressions::TsrExpr<Array_> B,
     C.array.set(index, tile);
   }
 
-  for (auto &w : worlds) {
-    w->gop.fence();
-  }
+  world.gop.fence();
 
   return C.array;
 }
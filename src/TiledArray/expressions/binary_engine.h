@@ -310,6 +310,17 @@ class BinaryEngine : public ExprEngine<Derived> {
     right_.print(os, indices_);
     os.dec();
   }
+
+  /// Expression cost accumulation
+
+  /// \tparam Cost An ExprCost type
+  /// \param cost The cost accumulator
+  template <typename Cost>
+  void accumulate_cost(Cost& cost) const {
+    left_.accumulate_cost(cost);
+    right_.accumulate_cost(cost);
+    ExprEngine_::accumulate_tile_cost(cost, 1.0);
+  }
 };  // class BinaryEngine
 
 }  // namespace expressions
@@ -266,6 +266,7 @@ class BlkTsrEngineBase : public LeafEngine<Derived> {
     std::shared_ptr<impl_type> pimpl = std::make_shared<impl_type>(
         array_, *world_, trange_, shape_, pmap_, perm_, ExprEngine_::make_op(),
         lower_bound_, upper_bound_);
+    pimpl->set_wire_compression(array_.wire_compression());
 
     return dist_eval_type(pimpl);
   }
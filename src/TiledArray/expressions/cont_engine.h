@@ -28,6 +28,7 @@
 
 #include <TiledArray/dist_eval/contraction_eval.h>
 #include <TiledArray/expressions/binary_engine.h>
+#include <TiledArray/expressions/expr_cost.h>
 #include <TiledArray/expressions/permopt.h>
 #include <TiledArray/proc_grid.h>
 #include <TiledArray/tensor/utility.h>
@@ -43,6 +44,21 @@ class MultExpr;
 template <typename, typename, typename>
 class ScalMultExpr;
 
+/// Detects scaled leaf engines whose factor can be folded into a contraction
+
+/// The factor of a \c ScalTsrEngine can be applied by GEMM instead when the
+/// scaled tiles have the type of the array tiles and the factor has the type of
+/// the contraction factor.
+/// \tparam E The argument engine type
+/// \tparam Scalar The contraction scalar type
+template <typename E, typename Scalar>
+struct is_foldable_scal_engine : public std::false_type {};
+
+template <typename Tile, typename Policy, typename Scalar, typename Result>
+struct is_foldable_scal_engine<
+    ScalTsrEngine<DistArray<Tile, Policy>, Scalar, Result>, Scalar>
+    : public std::is_same<Result, typename eval_trait<Tile>::type> {};
+
 /// Multiplication expression engine
 
 /// \tparam Derived The derived engine type
@@ -130,6 +146,16 @@ class ContEngine : public BinaryEngine<Derived> {
     return i;
   }
 
+  /// Move the scaling factor of a scaled leaf argument into \c factor_
+
+  /// \tparam E The argument engine type
+  /// \param arg The argument engine
+  template <typename E>
+  void fold_factor(E& arg) {
+    if constexpr (is_foldable_scal_engine<E, scalar_type>::value)
+      factor_ *= arg.release_factor();
+  }
+
   TensorProduct product_type_ = TensorProduct::Invalid;
   TensorProduct inner_product_type_ = TensorProduct::Invalid;
 
@@ -243,6 +269,13 @@ class ContEngine : public BinaryEngine<Derived> {
       TA_ASSERT(inner_tile_return_op_);
     }
 
+    // Fold the factors of scaled leaf arguments into the GEMM alpha, so that
+    // their tiles are contracted as stored rather than scaled into temporaries
+    if constexpr (!TiledArray::detail::is_tensor_of_tensor_v<value_type>) {
+      fold_factor(left_);
+      fold_factor(right_);
+    }
+
     // Initialize children
     left_.init_struct(left_indices_);
     right_.init_struct(right_indices_);
@@ -455,6 +488,77 @@ class ContEngine : public BinaryEngine<Derived> {
     os.dec();
   }
 
+  /// Expression cost accumulation
+
+  /// In addition to the result tiles, this counts the SUMMA broadcasts: each
+  /// non-zero left tile is sent to the process row of its owner, and each
+  /// non-zero right tile to the process column of its owner. Every rank
+  /// that receives a tile is assumed to hold it for the whole evaluation.
+  /// The operation count includes all products of non-zero argument tiles.
+  /// \tparam Cost An ExprCost type
+  /// \param cost The cost accumulator
+  template <typename Cost>
+  void accumulate_cost(Cost& cost) const {
+    typedef TiledArray::detail::numeric_t<
+        typename eval_trait<typename left_type::value_type>::type>
+        left_numeric_type;
+    typedef TiledArray::detail::numeric_t<
+        typename eval_trait<typename right_type::value_type>::type>
+        right_numeric_type;
+
+    left_.accumulate_cost(cost);
+    right_.accumulate_cost(cost);
+    ExprEngine_::accumulate_tile_cost(cost, 0.0);
+
+    const unsigned int inner_rank = op_.gemm_helper().num_contract_ranks();
+    const unsigned int left_rank = op_.gemm_helper().left_rank();
+    const unsigned int right_rank = op_.gemm_helper().right_rank();
+    const unsigned int left_outer_rank = left_rank - inner_rank;
+
+    // Element counts of the fused row, inner, and column tiles
+    const std::vector<std::size_t> m =
+        detail::fused_tile_extents(left_.trange(), 0u, left_outer_rank);
+    const std::vector<std::size_t> k = detail::fused_tile_extents(
+        left_.trange(), left_outer_rank, left_rank);
+    const std::vector<std::size_t> n =
+        detail::fused_tile_extents(right_.trange(), inner_rank, right_rank);
+    const size_type M = m.size(), N = n.size();
+    const size_type P = proc_grid_.proc_rows(), Q = proc_grid_.proc_cols();
+
+    for (size_type kk = 0ul; kk < K_; ++kk) {
+      std::size_t rows = 0ul;
+      for (size_type i = 0ul; i < M; ++i) {
+        const size_type ord = i * K_ + kk;
+        if (left_.shape().is_zero(ord)) continue;
+        rows += m[i];
+        const std::size_t bytes = m[i] * k[kk] * sizeof(left_numeric_type);
+        const size_type owner = left_.pmap()->owner(ord);
+        const size_type row_first = owner - owner % Q;
+        for (size_type proc = row_first; proc < row_first + Q; ++proc) {
+          if (proc == owner) continue;
+          cost.memory[proc] += bytes;
+          cost.bcast_bytes += bytes;
+        }
+      }
+
+      std::size_t cols = 0ul;
+      for (size_type j = 0ul; j < N; ++j) {
+        const size_type ord = kk * N + j;
+        if (right_.shape().is_zero(ord)) continue;
+        cols += n[j];
+        const std::size_t bytes = k[kk] * n[j] * sizeof(right_numeric_type);
+        const size_type owner = right_.pmap()->owner(ord);
+        for (size_type proc = owner % Q; proc < P * Q; proc += Q) {
+          if (proc == owner) continue;
+          cost.memory[proc] += bytes;
+          cost.bcast_bytes += bytes;
+        }
+      }
+
+      cost.flops += 2.0 * double(rows) * double(k[kk]) * double(cols);
+    }
+  }
+
  protected:
   void init_inner_tile_op(const IndexList& inner_target_indices) {
     if constexpr (TiledArray::detail::is_tensor_of_tensor_v<value_type>) {
@@ -39,6 +39,7 @@
 #include "TiledArray/config.h"
 #include "TiledArray/tile.h"
 #include "TiledArray/tile_interface/trace.h"
+#include "expr_cost.h"
 #include "expr_engine.h"
 #ifdef TILEDARRAY_HAS_CUDA
 #include <TiledArray/cuda/cuda_task_fn.h>
@@ -47,11 +48,50 @@
 
 #include <TiledArray/tensor/type_traits.h>
 
+#include <functional>
+#include <vector>
+
 namespace TiledArray::expressions {
 
+namespace detail {
+
+/// The assignments deferred by the calling thread
+
+/// \return A reference to the list of waits of the ExprBatch that the
+/// assignments of the calling thread join (see ExprBatch::defer() ), or
+/// \c nullptr if the assignments are evaluated synchronously
+inline std::vector<std::function<void()>>*& deferred_assignments() {
+  static thread_local std::vector<std::function<void()>>* waits = nullptr;
+  return waits;
+}
+
+/// Suspends the deferral of the assignments of the calling thread
+
+/// The tasks that a thread executes while it waits (e.g. in Future::get() )
+/// are unrelated to the statements of its deferral scope, so their
+/// assignments must not join the batch; the deferral is restored when this
+/// object is destroyed.
+class SuspendDeferral {
+ private:
+  std::vector<std::function<void()>>* waits_;  ///< The suspended waits
+
+ public:
+  SuspendDeferral() : waits_(deferred_assignments()) {
+    deferred_assignments() = nullptr;
+  }
+
+  SuspendDeferral(const SuspendDeferral&) = delete;
+  SuspendDeferral& operator=(const SuspendDeferral&) = delete;
+
+  ~SuspendDeferral() { deferred_assignments() = waits_; }
+};  // class SuspendDeferral
+
+}  // namespace detail
+
 template <typename Engine>
 struct EngineParamOverride {
-  EngineParamOverride() : world(nullptr), pmap(), shape(nullptr) {}
+  EngineParamOverride()
+      : world(nullptr), pmap(), shape(nullptr), truncate(false) {}
 
   typedef
       typename EngineTrait<Engine>::policy policy;  ///< The result policy type
@@ -63,6 +103,7 @@ struct EngineParamOverride {
   World* world;
   std::shared_ptr<const pmap_interface> pmap;
   const shape_type* shape;
+  bool truncate;  ///< if true, the result shape is computed from tile norms
 };
 
 /// \brief type trait checks if T has array() member
@@ -142,6 +183,21 @@ class Expr {
     }
     return derived();
   }
+  /// Compute the shape of the result from the norms of its tiles
+
+  /// The norm of each result tile is computed by the task that produces it,
+  /// and the result tiles whose norms are below the threshold are dropped.
+  /// Hence \code c("i,j") = (a("i,k") * b("k,j")).set_truncate();
+  /// \endcode is equivalent to \code c("i,j") = a("i,k") * b("k,j");
+  /// c.truncate(); \endcode but avoids another pass over the result tiles.
+  /// Expressions that only copy (possibly scaled or permuted) argument tiles
+  /// are evaluated and then truncated.
+  /// \note Has no effect if the result is dense
+  Expr<Derived>& set_truncate() {
+    if (!override_ptr_) override_ptr_ = std::make_shared<override_type>();
+    override_ptr_->truncate = true;
+    return derived();
+  }
 
  private:
   /// Task function used to evaluate a lazy tile and apply an op
@@ -370,8 +426,58 @@ class Expr {
   /// \tparam A The array type
   /// \tparam Alias Tile alias flag
   /// \param tsr The tensor to be assigned
+  /// \note If the assignments of the calling thread are deferred (see
+  /// ExprBatch::defer() ), this returns as soon as the evaluation tasks are
+  /// submitted, like eval_to_async() , and the assignment joins the batch.
   template <typename A, bool Alias>
   void eval_to(TsrExpr<A, Alias>& tsr) const {
+    if (auto* waits = detail::deferred_assignments()) {
+      // the tasks executed while the evaluation is set up do not join
+      const Future<A> done = [&]() {
+        detail::SuspendDeferral suspend;
+        return eval_to(tsr, true);
+      }();
+      waits->emplace_back([done]() { done.get(); });
+    } else
+      eval_to(tsr, false);
+  }
+
+  /// Evaluate this object and assign it to \c tsr, without waiting
+
+  /// Same as <tt>eval_to(tsr)</tt>, except that this returns as soon as the
+  /// evaluation tasks are submitted. The tiles of \c tsr are futures that
+  /// are set as the tiles are evaluated, hence \c tsr may immediately be
+  /// used as an argument of other expressions, which then only depend on
+  /// the tiles they use. This allows independent expressions to be
+  /// evaluated concurrently:
+  /// \code
+  /// auto c_done = c("i,j").assign_async(a("i,k") * b("k,j"));
+  /// auto f_done = f("i,j").assign_async(d("i,k") * e("k,j"));
+  /// c_done.get();
+  /// f_done.get();
+  /// \endcode
+  /// \note If truncation was requested by set_truncate(), the result shape
+  /// depends on all result tiles, hence the evaluation is synchronous.
+  /// \tparam A The array type
+  /// \tparam Alias Tile alias flag
+  /// \param tsr The tensor to be assigned
+  /// \return A future to the result array, which is set when the local
+  /// tiles of the result are set and the local evaluation tasks are done
+  template <typename A, bool Alias>
+  Future<A> eval_to_async(TsrExpr<A, Alias>& tsr) const {
+    return eval_to(tsr, true);
+  }
+
+ private:
+  /// Evaluate this object and assign it to \c tsr
+
+  /// \tparam A The array type
+  /// \tparam Alias Tile alias flag
+  /// \param tsr The tensor to be assigned
+  /// \param async If false, wait for the evaluation to finish
+  /// \return A future to the result array
+  template <typename A, bool Alias>
+  Future<A> eval_to(TsrExpr<A, Alias>& tsr, const bool async) const {
     static_assert(!is_lazy_tile<typename A::value_type>::value,
                   "Assignment to an array of lazy tiles is not supported.");
 
@@ -401,25 +507,123 @@ class Expr {
     engine.init(world, pmap, target_indices);
 
     // Create the distributed evaluator from this expression
-    typename engine_type::dist_eval_type dist_eval = engine.make_dist_eval();
+    typedef typename engine_type::dist_eval_type dist_eval_type;
+    dist_eval_type dist_eval = engine.make_dist_eval();
+    const bool truncate =
+        !is_dense_v<A> && override_ptr_ && override_ptr_->truncate;
+    constexpr bool record_norms =
+        !is_dense_v<A> && dist_eval_type::impl_type::can_record_tile_norms;
+    if constexpr (record_norms) {
+      if (truncate) dist_eval.record_tile_norms();
+    }
     dist_eval.eval();
 
     // Create the result array
-    A result(dist_eval.world(), dist_eval.trange(), dist_eval.shape(),
-             dist_eval.pmap());
+    A result;
+    if constexpr (record_norms) {
+      if (truncate) {
+        // The shape is computed from the norms recorded as the tiles were
+        // set by this node, which are summed over all nodes
+        dist_eval.wait();
+        result = A(dist_eval.world(), dist_eval.trange(),
+                   typename A::shape_type(dist_eval.world(),
+                                          *dist_eval.tile_norms(),
+                                          dist_eval.trange()),
+                   dist_eval.pmap());
+      }
+    }
+    if (!result.is_initialized())
+      result = A(dist_eval.world(), dist_eval.trange(), dist_eval.shape(),
+                 dist_eval.pmap());
+    if (tsr.array().is_initialized())
+      result.set_wire_compression(tsr.array().wire_compression());
 
     // Move the data from dist_eval into the result array. There is no
     // communication in this step.
     for (const auto index : *dist_eval.pmap()) {
       if (dist_eval.is_zero(index)) continue;
+      if (result.is_zero(index)) {
+        dist_eval.discard(index);
+        continue;
+      }
       auto tile_contents = dist_eval.get(index);
       set_tile(result, index, tile_contents);
     }
 
-    // Wait for child expressions of dist_eval
-    dist_eval.wait();
+    if (!async || truncate) {
+      // Wait for child expressions of dist_eval
+      dist_eval.wait();
+      if constexpr (!record_norms && !is_dense_v<A>) {
+        if (truncate) result.truncate();
+      }
+      // Swap the new array with the result array object.
+      result.swap(tsr.array());
+      return Future<A>(tsr.array());
+    }
+
+    // The evaluation is done when the local result tiles are set, and the
+    // local tasks of dist_eval (which may set tiles owned by other nodes)
+    // are done. dist_eval is held by the task until then.
+    std::vector<Future<typename A::value_type>> local_tiles;
+    for (const auto index : *result.pmap()) {
+      if (!result.is_zero(index))
+        local_tiles.push_back(result.find_local(index));
+    }
+    Future<A> done = result.world().taskq.add(
+        [dist_eval, result](
+            const std::vector<Future<typename A::value_type>>&) -> A {
+          detail::SuspendDeferral suspend;
+          dist_eval.wait();
+          return result;
+        },
+        local_tiles);
+
     // Swap the new array with the result array object.
     result.swap(tsr.array());
+    return done;
+  }
+
+ public:
+  /// Predict the cost of assigning this expression to \c tsr
+
+  /// The expression engine is initialized exactly as by <tt>eval_to(tsr)</tt>,
+  /// which determines the shapes, the process maps, and the SUMMA process
+  /// grids of the result and of all intermediates, but no tile is evaluated
+  /// and there is no communication; every rank computes the same estimate.
+  /// \c tsr is not modified. For example:
+  /// \code
+  /// auto cost = (a("i,k") * b("k,j")).dry_run(c("i,j"));
+  /// if (cost.peak_memory() > budget) { ... }
+  /// \endcode
+  /// \tparam A The array type
+  /// \tparam Alias Tile alias flag
+  /// \param tsr The tensor that would be assigned
+  /// \return The predicted shape of the result and the cost of its
+  /// evaluation; see ExprCost for the underlying assumptions
+  template <typename A, bool Alias>
+  ExprCost<typename A::shape_type> dry_run(
+      const TsrExpr<A, Alias>& tsr) const {
+    // Get the target world and the initial guess for the process map, as is
+    // done by eval_to()
+    const auto has_set_world = override_ptr_ && override_ptr_->world;
+    World& world = (tsr.array().is_initialized()
+                        ? tsr.array().world()
+                        : (has_set_world ? *override_ptr_->world
+                                         : TiledArray::get_default_world()));
+    std::shared_ptr<
+        const typename TsrExpr<A, Alias>::array_type::pmap_interface>
+        pmap;
+    if (tsr.array().is_initialized()) pmap = tsr.array().pmap();
+
+    // Construct and initialize the expression engine
+    engine_type engine(derived());
+    engine.init(world, pmap, BipartiteIndexList(tsr.annotation()));
+
+    ExprCost<typename A::shape_type> cost;
+    cost.memory.resize(world.size(), 0ul);
+    engine.accumulate_cost(cost);
+    cost.shape = engine.shape();
+    return cost;
   }
 
   /// Evaluate this object and assign it to \c tsr
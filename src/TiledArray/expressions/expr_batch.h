@@ -0,0 +1,157 @@
+/*
+ *  This file is a part of TiledArray.
+ *  Copyright (C) 2026  Virginia Tech
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *  expr_batch.h
+ *  October 19, 2026
+ *
+ */
+
+#ifndef TILEDARRAY_EXPRESSIONS_EXPR_BATCH_H__INCLUDED
+#define TILEDARRAY_EXPRESSIONS_EXPR_BATCH_H__INCLUDED
+
+#include <TiledArray/expressions/tsr_expr.h>
+
+#include <functional>
+#include <vector>
+
+namespace TiledArray {
+namespace expressions {
+
+/// A batch of independent expression assignments
+
+/// Evaluating a small expression is dominated by latency: the blocking
+/// assignment operator waits for all tasks of the expression before the next
+/// expression can be submitted. The assignments added to a batch are
+/// submitted immediately and asynchronously (see TsrExpr::assign_async() ),
+/// so the tasks of all of them are interleaved by the task queue, and
+/// wait() waits for all of them at once. For example:
+/// \code
+/// ExprBatch batch;
+/// for (std::size_t p = 0; p != pairs.size(); ++p)
+///   batch.add(t[p]("i,j"), g[p]("i,k") * c[p]("k,j"));
+/// batch.wait();
+/// \endcode
+/// The assignments must be independent of each other, i.e. a result of the
+/// batch must not also be assigned by another expression of the batch;
+/// results may be used as arguments of later expressions of the batch.
+///
+/// Sequences of ordinary assignment statements can join a batch too (see
+/// defer() ); then each statement only depends on the tiles of its
+/// arguments, rather than on the completion of the previous statements:
+/// \code
+/// ExprBatch batch;
+/// {
+///   auto deferral = batch.defer();
+///   t("i,j") = a("i,k") * b("k,j");
+///   u("i,j") = t("i,k") * c("k,j");  // starts as the tiles of t are set
+/// }
+/// batch.wait();
+/// \endcode
+/// Reassigning an array of the batch is allowed too: the assignment
+/// replaces the tiles of the array, while the pending expressions that use
+/// the array keep using its previous tiles.
+class ExprBatch {
+ private:
+  std::vector<std::function<void()>> waits_;  ///< Waits for each assignment
+
+ public:
+  /// Defers the assignments of the calling thread to a batch
+
+  /// The previous deferral of the thread, if any, is restored when this
+  /// object is destroyed.
+  class Deferral {
+   private:
+    std::vector<std::function<void()>>* previous_;  ///< The previous waits
+
+   public:
+    /// \param waits The waits of the batch
+    explicit Deferral(std::vector<std::function<void()>>& waits)
+        : previous_(detail::deferred_assignments()) {
+      detail::deferred_assignments() = &waits;
+    }
+
+    Deferral(const Deferral&) = delete;
+    Deferral& operator=(const Deferral&) = delete;
+
+    ~Deferral() { detail::deferred_assignments() = previous_; }
+  };  // class Deferral
+
+  ExprBatch() = default;
+  // A Deferral refers to the batch, so the batch is not movable
+  ExprBatch(const ExprBatch&) = delete;
+  ExprBatch(ExprBatch&&) = delete;
+  ExprBatch& operator=(const ExprBatch&) = delete;
+  ExprBatch& operator=(ExprBatch&&) = delete;
+
+  /// Waits for the assignments of the batch
+  ~ExprBatch() { wait(); }
+
+  /// Add an assignment to this batch
+
+  /// The evaluation of \p expr starts immediately; the tiles of the result
+  /// array are set as they are evaluated.
+  /// \tparam A The array type
+  /// \tparam Alias Tile alias flag
+  /// \tparam D The derived expression type
+  /// \param tsr The tensor to be assigned
+  /// \param expr The expression that will be assigned to \p tsr
+  /// \return A reference to this batch
+  template <typename A, bool Alias, typename D>
+  ExprBatch& add(TsrExpr<A, Alias> tsr, const Expr<D>& expr) {
+    Future<A> done = tsr.assign_async(expr);
+    waits_.emplace_back([done]() { done.get(); });
+    return *this;
+  }
+
+  /// Make the assignments of the calling thread join this batch
+
+  /// Until the returned object is destroyed, the assignment operators of
+  /// tensor expressions that are executed by the calling thread (e.g.
+  /// <tt>t("i,j") = a("i,k") * b("k,j")</tt>, and <tt>+=</tt> etc.) are
+  /// added to this batch (see add() ) instead of waiting for their
+  /// evaluation. The assignments of the tasks that this thread executes
+  /// while an assignment or the batch waits do not join the batch.
+  /// \return The object that ends the deferral when it is destroyed; it must
+  /// not outlive this batch
+  [[nodiscard]] Deferral defer() { return Deferral(waits_); }
+
+  /// Wait for the assignments of this batch
+
+  /// Executes tasks until the local tiles of all result arrays are
+  /// evaluated; the batch is empty afterwards.
+  void wait() {
+    // The tasks that are executed while waiting may add assignments
+    detail::SuspendDeferral suspend;
+    while (!waits_.empty()) {
+      std::vector<std::function<void()>> waits;
+      waits.swap(waits_);
+      for (auto& w : waits) w();
+    }
+  }
+
+  /// \return The number of assignments that are not waited for yet
+  std::size_t size() const { return waits_.size(); }
+
+  /// \return \c true if there are no assignments to wait for
+  bool empty() const { return waits_.empty(); }
+
+};  // class ExprBatch
+
+}  // namespace expressions
+}  // namespace TiledArray
+
+#endif  // TILEDARRAY_EXPRESSIONS_EXPR_BATCH_H__INCLUDED
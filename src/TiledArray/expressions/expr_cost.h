@@ -0,0 +1,109 @@
+/*
+ *  This file is a part of TiledArray.
+ *  Copyright (C) 2026  Virginia Tech
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *  expr_cost.h
+ *  October 19, 2026
+ *
+ */
+
+#ifndef TILEDARRAY_EXPRESSIONS_EXPR_COST_H__INCLUDED
+#define TILEDARRAY_EXPRESSIONS_EXPR_COST_H__INCLUDED
+
+#include <TiledArray/tiled_range.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <iostream>
+#include <vector>
+
+namespace TiledArray {
+namespace expressions {
+
+/// Predicted cost of evaluating an expression
+
+/// Computed by Expr::dry_run() from the shapes, tiled ranges and process
+/// maps of the result and of the intermediates of an expression, without
+/// evaluating any tile. The estimates are upper bounds in the sense that
+/// all products of non-zero argument tiles are counted (i.e. screening by
+/// the result shape is ignored), and that all tiles that a rank may hold
+/// during the evaluation are assumed to be held at once. The sizes of the
+/// tiles are those of their elements, i.e. the outer elements of
+/// tensor-of-tensor tiles.
+/// \tparam Shape The shape type of the result
+template <typename Shape>
+struct ExprCost {
+  Shape shape;          ///< The shape of the result
+  double flops = 0.0;   ///< The number of floating-point operations
+  /// The number of bytes of the result and intermediate tiles, and of the
+  /// argument tiles received by SUMMA broadcasts, held by each rank
+  std::vector<std::size_t> memory;
+  /// The number of bytes sent by the SUMMA broadcasts, over all ranks
+  std::size_t bcast_bytes = 0ul;
+
+  /// Largest number of bytes held by a rank
+
+  /// \return The maximum element of \c memory
+  std::size_t peak_memory() const {
+    return memory.empty() ? 0ul : *std::max_element(memory.begin(),
+                                                    memory.end());
+  }
+};  // struct ExprCost
+
+/// ExprCost output operator
+
+/// \param os The output stream
+/// \param cost The cost to be printed
+/// \return \c os
+template <typename Shape>
+inline std::ostream& operator<<(std::ostream& os, const ExprCost<Shape>& cost) {
+  os << "{ flops: " << cost.flops << ", peak memory: " << cost.peak_memory()
+     << " bytes, broadcast: " << cost.bcast_bytes << " bytes }";
+  return os;
+}
+
+namespace detail {
+
+/// Extents of the fused tiles of a range of dimensions
+
+/// \param trange The tiled range
+/// \param first The first dimension of the range
+/// \param last One past the last dimension of the range
+/// \return The number of elements of the tiles of the dimensions
+/// [first,last), fused in row-major order
+inline std::vector<std::size_t> fused_tile_extents(const TiledRange& trange,
+                                                   const unsigned int first,
+                                                   const unsigned int last) {
+  std::vector<std::size_t> result(1, 1ul);
+  for (unsigned int d = first; d < last; ++d) {
+    const TiledRange1& tr1 = trange.dim(d);
+    std::vector<std::size_t> fused;
+    fused.reserve(result.size() * tr1.tile_extent());
+    for (const auto extent : result)
+      for (auto t = tr1.tiles_range().first; t < tr1.tiles_range().second;
+           ++t)
+        fused.push_back(extent * (tr1.tile(t).second - tr1.tile(t).first));
+    result.swap(fused);
+  }
+  return result;
+}
+
+}  // namespace detail
+
+}  // namespace expressions
+}  // namespace TiledArray
+
+#endif  // TILEDARRAY_EXPRESSIONS_EXPR_COST_H__INCLUDED
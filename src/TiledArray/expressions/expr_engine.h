@@ -268,6 +268,42 @@ class ExprEngine : private NO_DEFAULTS {
   /// \return An expression tag used to identify this expression
   const char* make_tag() const { return ""; }
 
+  /// Expression cost accumulation
+
+  /// Adds the predicted cost of evaluating this expression, and of the
+  /// expressions it depends on, to \c cost . The engine must be initialized.
+  /// Derived classes add the cost of their arguments and customize the
+  /// number of operations per element.
+  /// \tparam Cost An ExprCost type
+  /// \param cost The cost accumulator
+  template <typename Cost>
+  void accumulate_cost(Cost& cost) const {
+    accumulate_tile_cost(cost, 1.0);
+  }
+
+  /// Accumulate the cost of the tiles of this expression
+
+  /// Adds the memory of the non-zero tiles of this expression to the ranks
+  /// that own them, and \c flops_per_element operations for each of their
+  /// elements.
+  /// \tparam Cost An ExprCost type
+  /// \param cost The cost accumulator
+  /// \param flops_per_element The number of operations per result element
+  template <typename Cost>
+  void accumulate_tile_cost(Cost& cost, const double flops_per_element) const {
+    typedef TiledArray::detail::numeric_t<value_type> numeric_type;
+    TA_ASSERT(pmap_);
+    TA_ASSERT(cost.memory.size() == std::size_t(world_->size()));
+
+    const auto volume = trange_.tiles_range().volume();
+    for (std::size_t ord = 0ul; ord < volume; ++ord) {
+      if (shape_.is_zero(ord)) continue;
+      const std::size_t tile_volume = trange_.make_tile_range(ord).volume();
+      cost.flops += flops_per_element * double(tile_volume);
+      cost.memory[pmap_->owner(ord)] += tile_volume * sizeof(numeric_type);
+    }
+  }
+
 };  // class ExprEngine
 
 }  // namespace expressions
@@ -167,10 +167,22 @@ class LeafEngine : public ExprEngine<Derived> {
     std::shared_ptr<impl_type> pimpl =
         std::make_shared<impl_type>(array_, *world_, trange_, shape_, pmap_,
                                     outer(perm_), ExprEngine_::make_op());
+    pimpl->set_wire_compression(array_.wire_compression());
 
     return dist_eval_type(pimpl);
   }
 
+  /// Expression cost accumulation
+
+  /// The tiles of the array already exist, only permuted copies of them are
+  /// counted.
+  /// \tparam Cost An ExprCost type
+  /// \param cost The cost accumulator
+  template <typename Cost>
+  void accumulate_cost(Cost& cost) const {
+    if (perm_) ExprEngine_::accumulate_tile_cost(cost, 0.0);
+  }
+
 };  // class LeafEngine
 
 }  // namespace expressions
@@ -463,6 +463,18 @@ class MultEngine : public ContEngine<MultEngine<Left, Right, Result>> {
     else
       return BinaryEngine_::print(os, target_indices);
   }
+
+  /// Expression cost accumulation
+
+  /// \tparam Cost An ExprCost type
+  /// \param cost The cost accumulator
+  template <typename Cost>
+  void accumulate_cost(Cost& cost) const {
+    if (this->product_type() == TensorProduct::Contraction)
+      ContEngine_::accumulate_cost(cost);
+    else
+      BinaryEngine_::accumulate_cost(cost);
+  }
 };  // class MultEngine
 
 /// Scaled multiplication expression engine
@@ -693,6 +705,18 @@ class ScalMultEngine
       return BinaryEngine_::print(os, target_indices);
   }
 
+  /// Expression cost accumulation
+
+  /// \tparam Cost An ExprCost type
+  /// \param cost The cost accumulator
+  template <typename Cost>
+  void accumulate_cost(Cost& cost) const {
+    if (this->product_type() == TensorProduct::Contraction)
+      ContEngine_::accumulate_cost(cost);
+    else
+      BinaryEngine_::accumulate_cost(cost);
+  }
+
 };  // class ScalMultEngine
 
 }  // namespace expressions
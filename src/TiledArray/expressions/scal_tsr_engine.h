@@ -41,7 +41,7 @@ struct EngineTrait<ScalTsrEngine<DistArray<Tile, Policy>, Scalar, Result>> {
 
   // Operational typedefs
   typedef Scalar scalar_type;
-  typedef TiledArray::detail::Scal<
+  typedef TiledArray::detail::ReleasableScal<
       Result,
       typename TiledArray::eval_trait<typename array_type::value_type>::type,
       scalar_type,
@@ -111,13 +111,32 @@ class ScalTsrEngine : public LeafEngine<ScalTsrEngine<Array, Scalar, Result>> {
       pmap_interface;  ///< Process map interface type
 
  private:
-  scalar_type factor_;  ///< The scaling factor
+  scalar_type factor_;     ///< The scaling factor
+  bool released_ = false;  ///< If true, the factor is applied by the consumer
 
  public:
   template <typename A, typename S>
   ScalTsrEngine(const ScalTsrExpr<A, S>& expr)
       : LeafEngine_(expr), factor_(expr.factor()) {}
 
+  /// Scaling factor accessor
+
+  /// \return The scaling factor
+  scalar_type factor() const { return factor_; }
+
+  /// Hand the scaling factor over to the consumer of this expression
+
+  /// Once the factor is released the tiles are evaluated as by TsrEngine,
+  /// without scaling (see ReleasableScal), so the caller must apply the
+  /// returned factor itself. This must be called before init_struct().
+  /// \return The scaling factor
+  scalar_type release_factor() {
+    const scalar_type factor = factor_;
+    factor_ = scalar_type(1);
+    released_ = true;
+    return factor;
+  }
+
   /// Non-permuting shape factory function
 
   /// \return The result shape
@@ -134,7 +153,9 @@ class ScalTsrEngine : public LeafEngine<ScalTsrEngine<Array, Scalar, Result>> {
   /// Non-permuting tile operation factory function
 
   /// \return The tile operation
-  op_type make_tile_op() const { return op_type(op_base_type(factor_)); }
+  op_type make_tile_op() const {
+    return op_type(op_base_type(factor_, released_));
+  }
 
   /// Permuting tile operation factory function
 
@@ -143,7 +164,7 @@ class ScalTsrEngine : public LeafEngine<ScalTsrEngine<Array, Scalar, Result>> {
   template <typename Perm, typename = std::enable_if_t<
                                TiledArray::detail::is_permutation_v<Perm>>>
   op_type make_tile_op(const Perm& perm) const {
-    return op_type(op_base_type(factor_), perm);
+    return op_type(op_base_type(factor_, released_), perm);
   }
 
   /// Expression identification tag
@@ -155,6 +176,21 @@ class ScalTsrEngine : public LeafEngine<ScalTsrEngine<Array, Scalar, Result>> {
     return ss.str();
   }
 
+  /// Expression cost accumulation
+
+  /// Like LeafEngine::accumulate_cost(), only new tiles are counted: scaled
+  /// copies of the array tiles, or only permuted copies once the factor is
+  /// released (see release_factor() ).
+  /// \tparam Cost An ExprCost type
+  /// \param cost The cost accumulator
+  template <typename Cost>
+  void accumulate_cost(Cost& cost) const {
+    if (!released_)
+      ExprEngine_::accumulate_tile_cost(cost, 1.0);
+    else if (LeafEngine_::perm_)
+      ExprEngine_::accumulate_tile_cost(cost, 0.0);
+  }
+
 };  // class ScalTsrEngine
 
 }  // namespace expressions
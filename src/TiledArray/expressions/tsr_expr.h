@@ -170,6 +170,23 @@ class TsrExpr : public Expr<TsrExpr<Array, Alias>> {
     return operator=(MultExpr<TsrExpr_, D>(*this, other.derived()));
   }
 
+  /// Asynchronous expression assignment
+
+  /// Assigns \p other to this array without waiting for its evaluation to
+  /// finish; see Expr::eval_to_async() .
+  /// \tparam D The derived expression type
+  /// \param other The expression that will be assigned to this array
+  /// \return A future to the array, which is set when the local tiles of the
+  /// array are evaluated
+  template <typename D>
+  Future<array_type> assign_async(const Expr<D>& other) {
+    static_assert(
+        TiledArray::expressions::is_aliased<D>::value,
+        "no_alias() expressions are not allowed on the right-hand side of "
+        "the assignment operator.");
+    return other.derived().eval_to_async(*this);
+  }
+
   /// Array accessor
 
   /// \return a reference to the array variable referred to by this expression
@@ -184,6 +184,16 @@ class UnaryEngine : ExprEngine<Derived> {
     os.dec();
   }
 
+  /// Expression cost accumulation
+
+  /// \tparam Cost An ExprCost type
+  /// \param cost The cost accumulator
+  template <typename Cost>
+  void accumulate_cost(Cost& cost) const {
+    arg_.accumulate_cost(cost);
+    ExprEngine_::accumulate_tile_cost(cost, 1.0);
+  }
+
 };  // class UnaryEngine
 
 }  // namespace expressions
@@ -28,6 +28,7 @@
 
 #include <TiledArray/external/eigen.h>
 #include <TiledArray/type_traits.h>
+#include <TiledArray/util/threads.h>
 
 #include <blas/dot.hh>
 #include <blas/gemm.hh>
@@ -67,96 +68,145 @@ using Vector = ::Eigen::Matrix<T, ::Eigen::Dynamic, 1, ::Eigen::ColMajor>;
 
 // BLAS _GEMM wrapper functions
 
+// The BLAS-backed gemm calls let a threaded BLAS use the idle threads of the
+// pool when the result is large (see intra_tile_threads() )
+
+// the BLAS-backed overloads defined below, declared here so that the generic
+// version can dispatch to them after promoting mixed-precision operands
+inline void gemm(Op op_a, Op op_b, const integer m, const integer n,
+                 const integer k, const float alpha, const float* a,
+                 const integer lda, const float* b, const integer ldb,
+                 const float beta, float* c, const integer ldc);
+inline void gemm(Op op_a, Op op_b, const integer m, const integer n,
+                 const integer k, const double alpha, const double* a,
+                 const integer lda, const double* b, const integer ldb,
+                 const double beta, double* c, const integer ldc);
+inline void gemm(Op op_a, Op op_b, const integer m, const integer n,
+                 const integer k, const std::complex<float> alpha,
+                 const std::complex<float>* a, const integer lda,
+                 const std::complex<float>* b, const integer ldb,
+                 const std::complex<float> beta, std::complex<float>* c,
+                 const integer ldc);
+inline void gemm(Op op_a, Op op_b, const integer m, const integer n,
+                 const integer k, const std::complex<double> alpha,
+                 const std::complex<double>* a, const integer lda,
+                 const std::complex<double>* b, const integer ldb,
+                 const std::complex<double> beta, std::complex<double>* c,
+                 const integer ldc);
+
 template <typename S1, typename T1, typename T2, typename S2, typename T3>
 inline void gemm(Op op_a, Op op_b, const integer m, const integer n,
                  const integer k, const S1 alpha, const T1* a,
                  const integer lda, const T2* b, const integer ldb,
                  const S2 beta, T3* c, const integer ldc) {
-  // Define operations
-  static const unsigned int notrans_notrans = 0x00000000,
-                            notrans_trans = 0x00000004,
-                            trans_notrans = 0x00000001,
-                            trans_trans = 0x00000005,
-                            notrans_conjtrans = 0x00000008,
-                            trans_conjtrans = 0x00000009,
-                            conjtrans_notrans = 0x00000002,
-                            conjtrans_trans = 0x00000006,
-                            conjtrans_conjtrans = 0x0000000a;
-
-  // Construct matrix maps for a, b, and c.
-  typedef Eigen::Matrix<T1, Eigen::Dynamic, Eigen::Dynamic, Eigen::RowMajor>
-      matrixA_type;
-  typedef Eigen::Matrix<T2, Eigen::Dynamic, Eigen::Dynamic, Eigen::RowMajor>
-      matrixB_type;
-  typedef Eigen::Matrix<T3, Eigen::Dynamic, Eigen::Dynamic, Eigen::RowMajor>
-      matrixC_type;
-  Eigen::Map<const matrixA_type, Eigen::AutoAlign, Eigen::OuterStride<>> A(
-      a, (op_a == NoTranspose ? m : k), (op_a == NoTranspose ? k : m),
-      Eigen::OuterStride<>(lda));
-  Eigen::Map<const matrixB_type, Eigen::AutoAlign, Eigen::OuterStride<>> B(
-      b, (op_b == NoTranspose ? k : n), (op_b == NoTranspose ? n : k),
-      Eigen::OuterStride<>(ldb));
-  Eigen::Map<matrixC_type, Eigen::AutoAlign, Eigen::OuterStride<>> C(
-      c, m, n, Eigen::OuterStride<>(ldc));
-
-  const bool beta_is_nonzero = (beta != static_cast<S2>(0));
-
-  switch (to_int(op_a) | (to_int(op_b) << 2)) {
-    case notrans_notrans:
-      if (beta_is_nonzero)
-        C.noalias() = alpha * A * B + beta * C;
-      else
-        C.noalias() = alpha * A * B;
-      break;
-    case notrans_trans:
-      if (beta_is_nonzero)
-        C.noalias() = alpha * A * B.transpose() + beta * C;
-      else
-        C.noalias() = alpha * A * B.transpose();
-      break;
-    case trans_notrans:
-      if (beta_is_nonzero)
-        C.noalias() = alpha * A.transpose() * B + beta * C;
-      else
-        C.noalias() = alpha * A.transpose() * B;
-      break;
-    case trans_trans:
-      if (beta_is_nonzero)
-        C.noalias() = alpha * A.transpose() * B.transpose() + beta * C;
-      else
-        C.noalias() = alpha * A.transpose() * B.transpose();
-      break;
-
-    case notrans_conjtrans:
-      if (beta_is_nonzero)
-        C.noalias() = alpha * A * B.adjoint() + beta * C;
-      else
-        C.noalias() = alpha * A * B.adjoint();
-      break;
-    case trans_conjtrans:
-      if (beta_is_nonzero)
-        C.noalias() = alpha * A.transpose() * B.adjoint() + beta * C;
-      else
-        C.noalias() = alpha * A.transpose() * B.adjoint();
-      break;
-    case conjtrans_notrans:
-      if (beta_is_nonzero)
-        C.noalias() = alpha * A.adjoint() * B + beta * C;
-      else
-        C.noalias() = alpha * A.adjoint() * B;
-      break;
-    case conjtrans_trans:
-      if (beta_is_nonzero)
-        C.noalias() = alpha * A.adjoint() * B.transpose() + beta * C;
-      else
-        C.noalias() = alpha * A.adjoint() * B.transpose();
-      break;
-    case conjtrans_conjtrans:
-      if (beta_is_nonzero)
-        C.noalias() = alpha * A.adjoint() * B.adjoint() + beta * C;
-      else
-        C.noalias() = alpha * A.adjoint() * B.adjoint();
-      break;
+  // Mixed precision: promote the operands to the result type, so that the
+  // products are accumulated in the precision of the result (e.g. float
+  // operands contracted into a double result use dgemm). Promotion costs
+  // O(mk+kn) operations and memory, versus O(mnk) for the product.
+  if constexpr (!std::is_same_v<T1, T3> || !std::is_same_v<T2, T3>) {
+    const integer a_rows = (op_a == NoTranspose ? m : k);
+    const integer a_cols = (op_a == NoTranspose ? k : m);
+    const integer b_rows = (op_b == NoTranspose ? k : n);
+    const integer b_cols = (op_b == NoTranspose ? n : k);
+    Matrix<T3, Eigen::RowMajor> a_promoted(a_rows, a_cols);
+    Matrix<T3, Eigen::RowMajor> b_promoted(b_rows, b_cols);
+    for (integer i = 0; i < a_rows; ++i)
+      std::copy(a + i * lda, a + i * lda + a_cols,
+                a_promoted.data() + i * a_cols);
+    for (integer i = 0; i < b_rows; ++i)
+      std::copy(b + i * ldb, b + i * ldb + b_cols,
+                b_promoted.data() + i * b_cols);
+    gemm(op_a, op_b, m, n, k, static_cast<T3>(alpha),
+         static_cast<const T3*>(a_promoted.data()), a_cols,
+         static_cast<const T3*>(b_promoted.data()), b_cols,
+         static_cast<T3>(beta), c, ldc);
+  } else {
+    // Define operations
+    static const unsigned int notrans_notrans = 0x00000000,
+                              notrans_trans = 0x00000004,
+                              trans_notrans = 0x00000001,
+                              trans_trans = 0x00000005,
+                              notrans_conjtrans = 0x00000008,
+                              trans_conjtrans = 0x00000009,
+                              conjtrans_notrans = 0x00000002,
+                              conjtrans_trans = 0x00000006,
+                              conjtrans_conjtrans = 0x0000000a;
+
+    // Construct matrix maps for a, b, and c.
+    typedef Eigen::Matrix<T1, Eigen::Dynamic, Eigen::Dynamic, Eigen::RowMajor>
+        matrixA_type;
+    typedef Eigen::Matrix<T2, Eigen::Dynamic, Eigen::Dynamic, Eigen::RowMajor>
+        matrixB_type;
+    typedef Eigen::Matrix<T3, Eigen::Dynamic, Eigen::Dynamic, Eigen::RowMajor>
+        matrixC_type;
+    Eigen::Map<const matrixA_type, Eigen::AutoAlign, Eigen::OuterStride<>> A(
+        a, (op_a == NoTranspose ? m : k), (op_a == NoTranspose ? k : m),
+        Eigen::OuterStride<>(lda));
+    Eigen::Map<const matrixB_type, Eigen::AutoAlign, Eigen::OuterStride<>> B(
+        b, (op_b == NoTranspose ? k : n), (op_b == NoTranspose ? n : k),
+        Eigen::OuterStride<>(ldb));
+    Eigen::Map<matrixC_type, Eigen::AutoAlign, Eigen::OuterStride<>> C(
+        c, m, n, Eigen::OuterStride<>(ldc));
+
+    const bool beta_is_nonzero = (beta != static_cast<S2>(0));
+
+    switch (to_int(op_a) | (to_int(op_b) << 2)) {
+      case notrans_notrans:
+        if (beta_is_nonzero)
+          C.noalias() = alpha * A * B + beta * C;
+        else
+          C.noalias() = alpha * A * B;
+        break;
+      case notrans_trans:
+        if (beta_is_nonzero)
+          C.noalias() = alpha * A * B.transpose() + beta * C;
+        else
+          C.noalias() = alpha * A * B.transpose();
+        break;
+      case trans_notrans:
+        if (beta_is_nonzero)
+          C.noalias() = alpha * A.transpose() * B + beta * C;
+        else
+          C.noalias() = alpha * A.transpose() * B;
+        break;
+      case trans_trans:
+        if (beta_is_nonzero)
+          C.noalias() = alpha * A.transpose() * B.transpose() + beta * C;
+        else
+          C.noalias() = alpha * A.transpose() * B.transpose();
+        break;
+
+      case notrans_conjtrans:
+        if (beta_is_nonzero)
+          C.noalias() = alpha * A * B.adjoint() + beta * C;
+        else
+          C.noalias() = alpha * A * B.adjoint();
+        break;
+      case trans_conjtrans:
+        if (beta_is_nonzero)
+          C.noalias() = alpha * A.transpose() * B.adjoint() + beta * C;
+        else
+          C.noalias() = alpha * A.transpose() * B.adjoint();
+        break;
+      case conjtrans_notrans:
+        if (beta_is_nonzero)
+          C.noalias() = alpha * A.adjoint() * B + beta * C;
+        else
+          C.noalias() = alpha * A.adjoint() * B;
+        break;
+      case conjtrans_trans:
+        if (beta_is_nonzero)
+          C.noalias() = alpha * A.adjoint() * B.transpose() + beta * C;
+        else
+          C.noalias() = alpha * A.adjoint() * B.transpose();
+        break;
+      case conjtrans_conjtrans:
+        if (beta_is_nonzero)
+          C.noalias() = alpha * A.adjoint() * B.adjoint() + beta * C;
+        else
+          C.noalias() = alpha * A.adjoint() * B.adjoint();
+        break;
+    }
   }
 }
 
@@ -164,6 +214,7 @@ inline void gemm(Op op_a, Op op_b, const integer m, const integer n,
                  const integer k, const float alpha, const float* a,
                  const integer lda, const float* b, const integer ldb,
                  const float beta, float* c, const integer ldc) {
+  TA_INTRA_TILE_THREADS(m * n);
   ::blas::gemm(::blas::Layout::ColMajor, op_b, op_a, n, m, k, alpha, b, ldb, a,
                lda, beta, c, ldc);
 }
@@ -172,6 +223,7 @@ inline void gemm(Op op_a, Op op_b, const integer m, const integer n,
                  const integer k, const double alpha, const double* a,
                  const integer lda, const double* b, const integer ldb,
                  const double beta, double* c, const integer ldc) {
+  TA_INTRA_TILE_THREADS(m * n);
   ::blas::gemm(::blas::Layout::ColMajor, op_b, op_a, n, m, k, alpha, b, ldb, a,
                lda, beta, c, ldc);
 }
@@ -182,6 +234,7 @@ inline void gemm(Op op_a, Op op_b, const integer m, const integer n,
                  const std::complex<float>* b, const integer ldb,
                  const std::complex<float> beta, std::complex<float>* c,
                  const integer ldc) {
+  TA_INTRA_TILE_THREADS(m * n);
   ::blas::gemm(::blas::Layout::ColMajor, op_b, op_a, n, m, k, alpha, b, ldb, a,
                lda, beta, c, ldc);
 }
@@ -192,6 +245,7 @@ inline void gemm(Op op_a, Op op_b, const integer m, const integer n,
                  const std::complex<double>* b, const integer ldb,
                  const std::complex<double> beta, std::complex<double>* c,
                  const integer ldc) {
+  TA_INTRA_TILE_THREADS(m * n);
   ::blas::gemm(::blas::Layout::ColMajor, op_b, op_a, n, m, k, alpha, b, ldb, a,
                lda, beta, c, ldc);
 }
@@ -0,0 +1,198 @@
+/*
+ *  This file is a part of TiledArray.
+ *  Copyright (C) 2026  Virginia Tech
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *  parallel.h
+ *  October 19, 2026
+ *
+ */
+
+#ifndef TILEDARRAY_MATH_PARALLEL_H__INCLUDED
+#define TILEDARRAY_MATH_PARALLEL_H__INCLUDED
+
+#include <TiledArray/external/madness.h>
+#include <TiledArray/util/threads.h>
+
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <thread>
+#include <vector>
+
+namespace TiledArray {
+namespace detail {
+
+/// Chunk boundaries of element ranges are multiples of this many elements,
+/// so that every chunk of an aligned array is aligned for any vector
+/// instruction set
+static constexpr std::size_t parallel_chunk_alignment = 64ul;
+
+/// The chunk size used to split \c n indices among \c nchunks threads
+
+/// \param n The size of the index range
+/// \param nchunks The number of chunks
+/// \param align The chunk size is a multiple of \c align
+inline std::size_t parallel_chunk_size(const std::size_t n,
+                                       const std::size_t nchunks,
+                                       const std::size_t align) {
+  const std::size_t chunk = (n + nchunks - 1ul) / nchunks;
+  return std::max((chunk + align - 1ul) / align * align, align);
+}
+
+/// The chunks of a parallel_for() or parallel_reduce()
+
+/// The calling thread and the helper tasks claim the chunks one at a time
+/// until none is left. The calling thread then waits only for the chunks
+/// that other threads are processing, i.e. it does not execute unrelated
+/// tasks while it waits (as Future::get() would), which would delay the
+/// operation by the duration of those tasks and could nest arbitrarily
+/// deep.
+class ParallelChunks {
+ private:
+  const std::size_t nchunks_;           ///< The number of chunks
+  std::atomic<std::size_t> next_{0ul};  ///< The first unclaimed chunk
+  std::atomic<std::size_t> done_{0ul};  ///< The number of processed chunks
+  std::mutex mutex_;                    ///< Protects error_
+  std::exception_ptr error_;  ///< The first exception thrown by a chunk
+
+ public:
+  /// \param nchunks The number of chunks
+  explicit ParallelChunks(const std::size_t nchunks) : nchunks_(nchunks) {}
+
+  /// Process unclaimed chunks until none is left
+
+  /// \tparam Op The operation type, with signature
+  /// <tt>void op(std::size_t chunk)</tt>
+  /// \param op The operation that processes a chunk; it is only accessed
+  /// while a chunk is claimed, i.e. while wait() has not returned
+  template <typename Op>
+  void run(Op& op) {
+    for (std::size_t c = next_++; c < nchunks_; c = next_++) {
+      try {
+        op(c);
+      } catch (...) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (!error_) error_ = std::current_exception();
+      }
+      ++done_;
+    }
+  }
+
+  /// Wait until all chunks are processed
+
+  /// \throw The first exception thrown by a chunk
+  void wait() {
+    while (done_.load() < nchunks_) std::this_thread::yield();
+    if (error_) std::rethrow_exception(error_);
+  }
+
+};  // class ParallelChunks
+
+/// Process the chunks [0,nchunks) with the calling thread and helper tasks
+
+/// \tparam Op The operation type, with signature
+/// <tt>void op(std::size_t chunk)</tt>
+/// \param nchunks The number of chunks
+/// \param op The operation that processes a chunk; it is called
+/// concurrently for different chunks
+template <typename Op>
+void fork_join(const std::size_t nchunks, Op&& op) {
+  // Helper tasks that start after the last chunk is claimed return at once
+  auto chunks = std::make_shared<ParallelChunks>(nchunks);
+  World& world = get_default_world();
+  for (std::size_t i = 1ul; i < nchunks; ++i)
+    world.taskq.add([chunks, &op]() { chunks->run(op); });
+  chunks->run(op);
+  chunks->wait();
+}
+
+}  // namespace detail
+
+namespace math {
+
+/// Apply an operation to the index range [0,n), using idle threads
+
+/// Tile operations run inside a single MADNESS task. If the range is large
+/// enough and the thread pool has idle threads (see intra_tile_threads() ),
+/// the range is split into chunks, which are processed by the calling
+/// thread and by helper tasks (see detail::fork_join() ); the calling thread
+/// does not execute unrelated tasks while it waits for the chunks of other
+/// threads. Otherwise \c op is applied to the whole range by the calling
+/// thread.
+/// \tparam Op The operation type, with signature
+/// <tt>void op(std::size_t first, std::size_t last)</tt>
+/// \param n The size of the index range
+/// \param op The operation that processes a subrange; it is called
+/// concurrently for disjoint subranges
+/// \param block_volume The number of elements processed per index; if 1,
+/// the indices are elements and the chunks are aligned to
+/// detail::parallel_chunk_alignment elements
+template <typename Op>
+void parallel_for(const std::size_t n, Op&& op,
+                  const std::size_t block_volume = 1ul) {
+  const std::size_t nthreads =
+      std::min<std::size_t>(intra_tile_threads(n * block_volume), n);
+  if (nthreads <= 1ul) {
+    op(std::size_t(0), n);
+    return;
+  }
+
+  const std::size_t chunk = detail::parallel_chunk_size(
+      n, nthreads,
+      (block_volume == 1ul ? detail::parallel_chunk_alignment : 1ul));
+  const std::size_t nchunks = (n + chunk - 1ul) / chunk;
+  detail::fork_join(nchunks, [&op, n, chunk](const std::size_t c) {
+    op(c * chunk, std::min((c + 1ul) * chunk, n));
+  });
+}
+
+/// Reduce the index range [0,n), using idle threads
+
+/// This is the reduction analog of parallel_for() ; the partial results are
+/// joined in the order of the subranges.
+/// \tparam Result The result type
+/// \tparam Op The operation type, with signature
+/// <tt>Result op(std::size_t first, std::size_t last)</tt>
+/// \tparam JoinOp The join operation type, with signature
+/// <tt>Result join_op(const Result&, const Result&)</tt>
+/// \param n The size of the index range
+/// \param op The operation that reduces a subrange
+/// \param join_op The operation that combines the results of two subranges
+/// \return The reduction of the whole range
+template <typename Result, typename Op, typename JoinOp>
+Result parallel_reduce(const std::size_t n, Op&& op, JoinOp&& join_op) {
+  const std::size_t nthreads = intra_tile_threads(n);
+  if (nthreads <= 1ul) return op(std::size_t(0), n);
+
+  const std::size_t chunk = detail::parallel_chunk_size(
+      n, nthreads, detail::parallel_chunk_alignment);
+  std::vector<std::optional<Result>> partials((n + chunk - 1ul) / chunk);
+  detail::fork_join(partials.size(), [&](const std::size_t c) {
+    partials[c].emplace(op(c * chunk, std::min((c + 1ul) * chunk, n)));
+  });
+  Result result = std::move(*partials.front());
+  for (std::size_t c = 1ul; c < partials.size(); ++c)
+    result = join_op(result, *partials[c]);
+  return result;
+}
+
+}  // namespace math
+}  // namespace TiledArray
+
+#endif  // TILEDARRAY_MATH_PARALLEL_H__INCLUDED
@@ -0,0 +1,668 @@
+/*
+ *  This file is a part of TiledArray.
+ *  Copyright (C) 2026  Virginia Tech
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *  simd.h
+ *  October 19, 2026
+ *
+ */
+
+#ifndef TILEDARRAY_MATH_SIMD_H__INCLUDED
+#define TILEDARRAY_MATH_SIMD_H__INCLUDED
+
+#include <TiledArray/math/parallel.h>
+#include <TiledArray/math/vector_op.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <type_traits>
+
+#if (defined(__x86_64__) || defined(__i386__)) && \
+    (defined(__GNUC__) || defined(__clang__)) && !defined(__CUDACC__)
+#define TILEDARRAY_HAS_SIMD_X86 1
+#include <immintrin.h>
+// Kernels for each instruction set are compiled with the corresponding target
+// attribute, so that one binary can select them at runtime; flatten inlines
+// the vector traits into the kernels
+#define TILEDARRAY_SIMD_AVX2 __attribute__((target("avx2,fma"), flatten))
+#define TILEDARRAY_SIMD_AVX512 \
+  __attribute__((target("avx512f,avx2,fma"), flatten))
+#elif defined(__aarch64__) && defined(__ARM_NEON) && !defined(__CUDACC__)
+#define TILEDARRAY_HAS_SIMD_NEON 1
+#include <arm_neon.h>
+#endif
+
+namespace TiledArray {
+namespace math {
+namespace simd {
+
+/// Instruction sets of the vectorized kernels
+enum class ISA { scalar, neon, avx2, avx512 };
+
+/// Element types that have vectorized kernels
+template <typename T>
+constexpr bool is_simd_type_v =
+    std::is_same_v<T, float> || std::is_same_v<T, double>;
+
+/// Detects scaling factors that a kernel for \c T can use without changing
+/// the result, i.e. that promote to \c T in mixed arithmetic with \c T
+template <typename T, typename Scalar>
+constexpr bool is_simd_scalar_v =
+    is_simd_type_v<T> && std::is_arithmetic_v<Scalar> &&
+    (std::is_integral_v<Scalar> || sizeof(Scalar) <= sizeof(T));
+
+namespace detail {
+
+/// Detect the best instruction set supported by this CPU
+
+/// The result can be capped with the \c TA_SIMD environment variable
+/// (\c scalar , \c neon , \c avx2 , or \c avx512 ).
+inline ISA detect_isa() {
+  ISA result = ISA::scalar;
+#if defined(TILEDARRAY_HAS_SIMD_X86)
+  __builtin_cpu_init();
+  if (__builtin_cpu_supports("avx512f"))
+    result = ISA::avx512;
+  else if (__builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma"))
+    result = ISA::avx2;
+#elif defined(TILEDARRAY_HAS_SIMD_NEON)
+  result = ISA::neon;
+#endif
+
+  if (const char* cap = std::getenv("TA_SIMD")) {
+    ISA max_isa = result;
+    if (std::strcmp(cap, "scalar") == 0)
+      max_isa = ISA::scalar;
+    else if (std::strcmp(cap, "neon") == 0)
+      max_isa = ISA::neon;
+    else if (std::strcmp(cap, "avx2") == 0)
+      max_isa = ISA::avx2;
+    else if (std::strcmp(cap, "avx512") == 0)
+      max_isa = ISA::avx512;
+    // neon is not available on CPUs that support avx2
+    if (max_isa < result)
+      result = (max_isa == ISA::neon ? ISA::scalar : max_isa);
+  }
+
+  return result;
+}
+
+}  // namespace detail
+
+/// The instruction set used by the kernels
+
+/// \return The instruction set that is selected on the first call
+inline ISA isa() {
+  static const ISA result = detail::detect_isa();
+  return result;
+}
+
+namespace detail {
+
+/// Vector traits for the scalar fallback, a "vector" of one element
+
+/// \tparam T The element type
+template <typename T>
+struct ScalarVec {
+  typedef T type;
+  static constexpr std::size_t width = 1ul;
+  static constexpr std::size_t alignment = alignof(T);
+
+  template <bool Aligned>
+  static type load(const T* const p) {
+    return *p;
+  }
+  template <bool Aligned>
+  static void store(T* const p, const type v) {
+    *p = v;
+  }
+  static type set1(const T a) { return a; }
+  static type add(const type a, const type b) { return a + b; }
+  static type sub(const type a, const type b) { return a - b; }
+  static type mul(const type a, const type b) { return a * b; }
+  static type fmadd(const type a, const type b, const type c) {
+    return a * b + c;
+  }
+  static type abs(const type a) { return std::abs(a); }
+  static type max(const type a, const type b) { return std::max(a, b); }
+  static T sum(const type a) { return a; }
+  static T reduce_max(const type a) { return a; }
+};  // struct ScalarVec
+
+#if defined(TILEDARRAY_HAS_SIMD_X86)
+
+template <typename T>
+struct Avx2Vec;
+
+template <>
+struct Avx2Vec<double> {
+  typedef __m256d type;
+  static constexpr std::size_t width = 4ul;
+  static constexpr std::size_t alignment = sizeof(type);
+
+  template <bool Aligned>
+  TILEDARRAY_SIMD_AVX2 static type load(const double* const p) {
+    if constexpr (Aligned)
+      return _mm256_load_pd(p);
+    else
+      return _mm256_loadu_pd(p);
+  }
+  template <bool Aligned>
+  TILEDARRAY_SIMD_AVX2 static void store(double* const p, const type v) {
+    if constexpr (Aligned)
+      _mm256_store_pd(p, v);
+    else
+      _mm256_storeu_pd(p, v);
+  }
+  TILEDARRAY_SIMD_AVX2 static type set1(const double a) {
+    return _mm256_set1_pd(a);
+  }
+  TILEDARRAY_SIMD_AVX2 static type add(const type a, const type b) {
+    return _mm256_add_pd(a, b);
+  }
+  TILEDARRAY_SIMD_AVX2 static type sub(const type a, const type b) {
+    return _mm256_sub_pd(a, b);
+  }
+  TILEDARRAY_SIMD_AVX2 static type mul(const type a, const type b) {
+    return _mm256_mul_pd(a, b);
+  }
+  TILEDARRAY_SIMD_AVX2 static type fmadd(const type a, const type b,
+                                         const type c) {
+    return _mm256_fmadd_pd(a, b, c);
+  }
+  TILEDARRAY_SIMD_AVX2 static type abs(const type a) {
+    return _mm256_andnot_pd(_mm256_set1_pd(-0.0), a);
+  }
+  TILEDARRAY_SIMD_AVX2 static type max(const type a, const type b) {
+    return _mm256_max_pd(a, b);
+  }
+  TILEDARRAY_SIMD_AVX2 static double sum(const type a) {
+    __m128d v = _mm_add_pd(_mm256_castpd256_pd128(a),
+                           _mm256_extractf128_pd(a, 1));
+    return _mm_cvtsd_f64(_mm_add_sd(v, _mm_unpackhi_pd(v, v)));
+  }
+  TILEDARRAY_SIMD_AVX2 static double reduce_max(const type a) {
+    __m128d v = _mm_max_pd(_mm256_castpd256_pd128(a),
+                           _mm256_extractf128_pd(a, 1));
+    return _mm_cvtsd_f64(_mm_max_sd(v, _mm_unpackhi_pd(v, v)));
+  }
+};  // struct Avx2Vec<double>
+
+template <>
+struct Avx2Vec<float> {
+  typedef __m256 type;
+  static constexpr std::size_t width = 8ul;
+  static constexpr std::size_t alignment = sizeof(type);
+
+  template <bool Aligned>
+  TILEDARRAY_SIMD_AVX2 static type load(const float* const p) {
+    if constexpr (Aligned)
+      return _mm256_load_ps(p);
+    else
+      return _mm256_loadu_ps(p);
+  }
+  template <bool Aligned>
+  TILEDARRAY_SIMD_AVX2 static void store(float* const p, const type v) {
+    if constexpr (Aligned)
+      _mm256_store_ps(p, v);
+    else
+      _mm256_storeu_ps(p, v);
+  }
+  TILEDARRAY_SIMD_AVX2 static type set1(const float a) {
+    return _mm256_set1_ps(a);
+  }
+  TILEDARRAY_SIMD_AVX2 static type add(const type a, const type b) {
+    return _mm256_add_ps(a, b);
+  }
+  TILEDARRAY_SIMD_AVX2 static type sub(const type a, const type b) {
+    return _mm256_sub_ps(a, b);
+  }
+  TILEDARRAY_SIMD_AVX2 static type mul(const type a, const type b) {
+    return _mm256_mul_ps(a, b);
+  }
+  TILEDARRAY_SIMD_AVX2 static type fmadd(const type a, const type b,
+                                         const type c) {
+    return _mm256_fmadd_ps(a, b, c);
+  }
+  TILEDARRAY_SIMD_AVX2 static type abs(const type a) {
+    return _mm256_andnot_ps(_mm256_set1_ps(-0.0f), a);
+  }
+  TILEDARRAY_SIMD_AVX2 static type max(const type a, const type b) {
+    return _mm256_max_ps(a, b);
+  }
+  TILEDARRAY_SIMD_AVX2 static float sum(const type a) {
+    __m128 v =
+        _mm_add_ps(_mm256_castps256_ps128(a), _mm256_extractf128_ps(a, 1));
+    v = _mm_add_ps(v, _mm_movehl_ps(v, v));
+    return _mm_cvtss_f32(_mm_add_ss(v, _mm_shuffle_ps(v, v, 1)));
+  }
+  TILEDARRAY_SIMD_AVX2 static float reduce_max(const type a) {
+    __m128 v =
+        _mm_max_ps(_mm256_castps256_ps128(a), _mm256_extractf128_ps(a, 1));
+    v = _mm_max_ps(v, _mm_movehl_ps(v, v));
+    return _mm_cvtss_f32(_mm_max_ss(v, _mm_shuffle_ps(v, v, 1)));
+  }
+};  // struct Avx2Vec<float>
+
+template <typename T>
+struct Avx512Vec;
+
+template <>
+struct Avx512Vec<double> {
+  typedef __m512d type;
+  static constexpr std::size_t width = 8ul;
+  static constexpr std::size_t alignment = sizeof(type);
+
+  template <bool Aligned>
+  TILEDARRAY_SIMD_AVX512 static type load(const double* const p) {
+    if constexpr (Aligned)
+      return _mm512_load_pd(p);
+    else
+      return _mm512_loadu_pd(p);
+  }
+  template <bool Aligned>
+  TILEDARRAY_SIMD_AVX512 static void store(double* const p, const type v) {
+    if constexpr (Aligned)
+      _mm512_store_pd(p, v);
+    else
+      _mm512_storeu_pd(p, v);
+  }
+  TILEDARRAY_SIMD_AVX512 static type set1(const double a) {
+    return _mm512_set1_pd(a);
+  }
+  TILEDARRAY_SIMD_AVX512 static type add(const type a, const type b) {
+    return _mm512_add_pd(a, b);
+  }
+  TILEDARRAY_SIMD_AVX512 static type sub(const type a, const type b) {
+    return _mm512_sub_pd(a, b);
+  }
+  TILEDARRAY_SIMD_AVX512 static type mul(const type a, const type b) {
+    return _mm512_mul_pd(a, b);
+  }
+  TILEDARRAY_SIMD_AVX512 static type fmadd(const type a, const type b,
+                                           const type c) {
+    return _mm512_fmadd_pd(a, b, c);
+  }
+  TILEDARRAY_SIMD_AVX512 static type abs(const type a) {
+    return _mm512_abs_pd(a);
+  }
+  TILEDARRAY_SIMD_AVX512 static type max(const type a, const type b) {
+    return _mm512_max_pd(a, b);
+  }
+  TILEDARRAY_SIMD_AVX512 static double sum(const type a) {
+    return _mm512_reduce_add_pd(a);
+  }
+  TILEDARRAY_SIMD_AVX512 static double reduce_max(const type a) {
+    return _mm512_reduce_max_pd(a);
+  }
+};  // struct Avx512Vec<double>
+
+template <>
+struct Avx512Vec<float> {
+  typedef __m512 type;
+  static constexpr std::size_t width = 16ul;
+  static constexpr std::size_t alignment = sizeof(type);
+
+  template <bool Aligned>
+  TILEDARRAY_SIMD_AVX512 static type load(const float* const p) {
+    if constexpr (Aligned)
+      return _mm512_load_ps(p);
+    else
+      return _mm512_loadu_ps(p);
+  }
+  template <bool Aligned>
+  TILEDARRAY_SIMD_AVX512 static void store(float* const p, const type v) {
+    if constexpr (Aligned)
+      _mm512_store_ps(p, v);
+    else
+      _mm512_storeu_ps(p, v);
+  }
+  TILEDARRAY_SIMD_AVX512 static type set1(const float a) {
+    return _mm512_set1_ps(a);
+  }
+  TILEDARRAY_SIMD_AVX512 static type add(const type a, const type b) {
+    return _mm512_add_ps(a, b);
+  }
+  TILEDARRAY_SIMD_AVX512 static type sub(const type a, const type b) {
+    return _mm512_sub_ps(a, b);
+  }
+  TILEDARRAY_SIMD_AVX512 static type mul(const type a, const type b) {
+    return _mm512_mul_ps(a, b);
+  }
+  TILEDARRAY_SIMD_AVX512 static type fmadd(const type a, const type b,
+                                           const type c) {
+    return _mm512_fmadd_ps(a, b, c);
+  }
+  TILEDARRAY_SIMD_AVX512 static type abs(const type a) {
+    return _mm512_abs_ps(a);
+  }
+  TILEDARRAY_SIMD_AVX512 static type max(const type a, const type b) {
+    return _mm512_max_ps(a, b);
+  }
+  TILEDARRAY_SIMD_AVX512 static float sum(const type a) {
+    return _mm512_reduce_add_ps(a);
+  }
+  TILEDARRAY_SIMD_AVX512 static float reduce_max(const type a) {
+    return _mm512_reduce_max_ps(a);
+  }
+};  // struct Avx512Vec<float>
+
+#elif defined(TILEDARRAY_HAS_SIMD_NEON)
+
+template <typename T>
+struct NeonVec;
+
+template <>
+struct NeonVec<double> {
+  typedef float64x2_t type;
+  static constexpr std::size_t width = 2ul;
+  static constexpr std::size_t alignment = sizeof(type);
+
+  template <bool Aligned>
+  static type load(const double* const p) {
+    return vld1q_f64(p);
+  }
+  template <bool Aligned>
+  static void store(double* const p, const type v) {
+    vst1q_f64(p, v);
+  }
+  static type set1(const double a) { return vdupq_n_f64(a); }
+  static type add(const type a, const type b) { return vaddq_f64(a, b); }
+  static type sub(const type a, const type b) { return vsubq_f64(a, b); }
+  static type mul(const type a, const type b) { return vmulq_f64(a, b); }
+  static type fmadd(const type a, const type b, const type c) {
+    return vfmaq_f64(c, a, b);
+  }
+  static type abs(const type a) { return vabsq_f64(a); }
+  static type max(const type a, const type b) { return vmaxq_f64(a, b); }
+  static double sum(const type a) { return vaddvq_f64(a); }
+  static double reduce_max(const type a) { return vmaxvq_f64(a); }
+};  // struct NeonVec<double>
+
+template <>
+struct NeonVec<float> {
+  typedef float32x4_t type;
+  static constexpr std::size_t width = 4ul;
+  static constexpr std::size_t alignment = sizeof(type);
+
+  template <bool Aligned>
+  static type load(const float* const p) {
+    return vld1q_f32(p);
+  }
+  template <bool Aligned>
+  static void store(float* const p, const type v) {
+    vst1q_f32(p, v);
+  }
+  static type set1(const float a) { return vdupq_n_f32(a); }
+  static type add(const type a, const type b) { return vaddq_f32(a, b); }
+  static type sub(const type a, const type b) { return vsubq_f32(a, b); }
+  static type mul(const type a, const type b) { return vmulq_f32(a, b); }
+  static type fmadd(const type a, const type b, const type c) {
+    return vfmaq_f32(c, a, b);
+  }
+  static type abs(const type a) { return vabsq_f32(a); }
+  static type max(const type a, const type b) { return vmaxq_f32(a, b); }
+  static float sum(const type a) { return vaddvq_f32(a); }
+  static float reduce_max(const type a) { return vmaxvq_f32(a); }
+};  // struct NeonVec<float>
+
+#endif
+
+// Kernels
+
+// The tags of the kernels, which are implemented for each instruction set by
+// simd_kernels.h. Element-wise kernels update y; reductions return a value,
+// and their tags provide identity() and join() for combining partial results.
+
+/// <tt>y[i] *= a</tt>
+struct Scale {};
+
+/// <tt>y[i] += a * x[i]</tt>
+struct Axpy {};
+
+/// <tt>y[i] += x[i]</tt>
+struct Add {};
+
+/// <tt>y[i] -= x[i]</tt>
+struct Subt {};
+
+/// <tt>y[i] *= x[i]</tt>
+struct Mult {};
+
+/// Sum of <tt>x[i] * y[i]</tt>
+struct Dot {
+  template <typename T>
+  static T identity() {
+    return T(0);
+  }
+  template <typename T>
+  static T join(const T a, const T b) {
+    return a + b;
+  }
+};  // struct Dot
+
+/// Sum of <tt>x[i] * x[i]</tt>
+struct SquaredNorm : public Dot {};
+
+/// Maximum of <tt>|x[i]|</tt>
+struct AbsMax {
+  template <typename T>
+  static T identity() {
+    return T(0);
+  }
+  template <typename T>
+  static T join(const T a, const T b) {
+    return std::max(a, b);
+  }
+};  // struct AbsMax
+
+namespace scalar {
+#define TILEDARRAY_SIMD_TARGET
+#include <TiledArray/math/simd_kernels.h>
+#undef TILEDARRAY_SIMD_TARGET
+}  // namespace scalar
+
+#if defined(TILEDARRAY_HAS_SIMD_X86)
+
+namespace avx2 {
+#define TILEDARRAY_SIMD_TARGET TILEDARRAY_SIMD_AVX2
+#include <TiledArray/math/simd_kernels.h>
+#undef TILEDARRAY_SIMD_TARGET
+}  // namespace avx2
+
+namespace avx512 {
+#define TILEDARRAY_SIMD_TARGET TILEDARRAY_SIMD_AVX512
+#include <TiledArray/math/simd_kernels.h>
+#undef TILEDARRAY_SIMD_TARGET
+}  // namespace avx512
+
+#elif defined(TILEDARRAY_HAS_SIMD_NEON)
+
+namespace neon {
+#define TILEDARRAY_SIMD_TARGET
+#include <TiledArray/math/simd_kernels.h>
+#undef TILEDARRAY_SIMD_TARGET
+}  // namespace neon
+
+#endif
+
+/// Run a kernel with the instruction set selected by isa()
+template <typename Kernel, typename T, typename Y>
+inline auto dispatch(const std::size_t n, const T a, const T* const x,
+                     Y* const y) {
+  switch (isa()) {
+#if defined(TILEDARRAY_HAS_SIMD_X86)
+    case ISA::avx512:
+      return avx512::invoke<Avx512Vec<T>, Kernel>(n, a, x, y);
+    case ISA::avx2:
+      return avx2::invoke<Avx2Vec<T>, Kernel>(n, a, x, y);
+#elif defined(TILEDARRAY_HAS_SIMD_NEON)
+    case ISA::neon:
+      return neon::invoke<NeonVec<T>, Kernel>(n, a, x, y);
+#endif
+    default:
+      return scalar::invoke<ScalarVec<T>, Kernel>(n, a, x, y);
+  }
+}
+
+/// Run an element-wise kernel, in parallel if TBB is available or if there
+/// are idle threads (see math::parallel_for() )
+template <typename Kernel, typename T>
+inline void for_each(const std::size_t n, const T a, const T* const x,
+                     T* const y) {
+#ifdef HAVE_INTEL_TBB
+  tbb::parallel_for(
+      SizeTRange(0ul, n),
+      [=](const SizeTRange& range) {
+        const std::size_t offset = range.begin();
+        dispatch<Kernel>(range.size(), a, (x ? x + offset : x), y + offset);
+      },
+      tbb::auto_partitioner());
+#else
+  math::parallel_for(n, [=](const std::size_t first, const std::size_t last) {
+    dispatch<Kernel>(last - first, a, (x ? x + first : x), y + first);
+  });
+#endif
+}
+
+/// Run a reduction kernel, in parallel if TBB is available or if there are
+/// idle threads (see math::parallel_reduce() )
+template <typename Kernel, typename T>
+inline T reduce(const std::size_t n, const T* const x, const T* const y) {
+#ifdef HAVE_INTEL_TBB
+  return tbb::parallel_reduce(
+      SizeTRange(0ul, n), Kernel::template identity<T>(),
+      [=](const SizeTRange& range, const T partial) {
+        const std::size_t offset = range.begin();
+        return Kernel::join(partial,
+                            dispatch<Kernel>(range.size(), T(0), x + offset,
+                                             (y ? y + offset : y)));
+      },
+      [](const T a, const T b) { return Kernel::join(a, b); },
+      tbb::auto_partitioner());
+#else
+  return math::parallel_reduce<T>(
+      n,
+      [=](const std::size_t first, const std::size_t last) {
+        return dispatch<Kernel>(last - first, T(0), x + first,
+                                (y ? y + first : y));
+      },
+      [](const T a, const T b) { return Kernel::join(a, b); });
+#endif
+}
+
+}  // namespace detail
+
+/// Scale a vector, <tt>x[i] *= a</tt>
+
+/// \tparam T The element type, \c float or \c double
+/// \param n The number of elements
+/// \param a The scaling factor
+/// \param x The vector to be scaled
+template <typename T, typename = std::enable_if_t<is_simd_type_v<T>>>
+inline void scale(const std::size_t n, const T a, T* const x) {
+  detail::for_each<detail::Scale>(n, a, static_cast<const T*>(nullptr), x);
+}
+
+/// Add a scaled vector to another, <tt>y[i] += a * x[i]</tt>
+
+/// \tparam T The element type, \c float or \c double
+/// \param n The number of elements
+/// \param a The scaling factor of \c x
+/// \param x The vector to be added
+/// \param y The vector that will be updated
+template <typename T, typename = std::enable_if_t<is_simd_type_v<T>>>
+inline void axpy(const std::size_t n, const T a, const T* const x,
+                 T* const y) {
+  detail::for_each<detail::Axpy>(n, a, x, y);
+}
+
+/// Add a vector to another, <tt>y[i] += x[i]</tt>
+
+/// \tparam T The element type, \c float or \c double
+/// \param n The number of elements
+/// \param x The vector to be added
+/// \param y The vector that will be updated
+template <typename T, typename = std::enable_if_t<is_simd_type_v<T>>>
+inline void add(const std::size_t n, const T* const x, T* const y) {
+  detail::for_each<detail::Add>(n, T(1), x, y);
+}
+
+/// Subtract a vector from another, <tt>y[i] -= x[i]</tt>
+
+/// \tparam T The element type, \c float or \c double
+/// \param n The number of elements
+/// \param x The vector to be subtracted
+/// \param y The vector that will be updated
+template <typename T, typename = std::enable_if_t<is_simd_type_v<T>>>
+inline void subt(const std::size_t n, const T* const x, T* const y) {
+  detail::for_each<detail::Subt>(n, T(1), x, y);
+}
+
+/// Multiply a vector by another element-wise, <tt>y[i] *= x[i]</tt>
+
+/// \tparam T The element type, \c float or \c double
+/// \param n The number of elements
+/// \param x The multiplier
+/// \param y The vector that will be updated
+template <typename T, typename = std::enable_if_t<is_simd_type_v<T>>>
+inline void mult(const std::size_t n, const T* const x, T* const y) {
+  detail::for_each<detail::Mult>(n, T(1), x, y);
+}
+
+/// Dot product of two vectors
+
+/// \tparam T The element type, \c float or \c double
+/// \param n The number of elements
+/// \param x The first vector
+/// \param y The second vector
+/// \return The sum of <tt>x[i] * y[i]</tt>
+template <typename T, typename = std::enable_if_t<is_simd_type_v<T>>>
+inline T dot(const std::size_t n, const T* const x, const T* const y) {
+  return detail::reduce<detail::Dot>(n, x, y);
+}
+
+/// Square of the 2-norm of a vector
+
+/// \tparam T The element type, \c float or \c double
+/// \param n The number of elements
+/// \param x The vector
+/// \return The sum of <tt>x[i] * x[i]</tt>
+template <typename T, typename = std::enable_if_t<is_simd_type_v<T>>>
+inline T squared_norm(const std::size_t n, const T* const x) {
+  return detail::reduce<detail::SquaredNorm>(n, x,
+                                             static_cast<const T*>(nullptr));
+}
+
+/// Maximum absolute value of the elements of a vector
+
+/// \tparam T The element type, \c float or \c double
+/// \param n The number of elements
+/// \param x The vector
+/// \return The maximum of <tt>|x[i]|</tt>, or 0 if \c n is 0
+template <typename T, typename = std::enable_if_t<is_simd_type_v<T>>>
+inline T abs_max(const std::size_t n, const T* const x) {
+  return detail::reduce<detail::AbsMax>(n, x, static_cast<const T*>(nullptr));
+}
+
+}  // namespace simd
+}  // namespace math
+}  // namespace TiledArray
+
+#endif  // TILEDARRAY_MATH_SIMD_H__INCLUDED
@@ -0,0 +1,156 @@
+/*
+ *  This file is a part of TiledArray.
+ *  Copyright (C) 2026  Virginia Tech
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *  simd_kernels.h
+ *  October 19, 2026
+ *
+ */
+
+// This file has no include guard: math/simd.h includes it once per
+// instruction set, in a namespace of its own, with TILEDARRAY_SIMD_TARGET
+// defined as the target attribute of the instruction set. Every function
+// that handles vector values is thus compiled for the instruction set of
+// those values, and invoke() , the entry point, only takes and returns
+// pointers and scalars.
+
+#ifndef TILEDARRAY_SIMD_TARGET
+#error "simd_kernels.h must only be included by TiledArray/math/simd.h"
+#endif
+
+// All kernels share the signature apply<V, Aligned>(kernel, n, a, x, y),
+// where kernel is the tag of the kernel, V are the vector traits, and
+// Aligned is true when x and y are aligned to V::alignment
+
+template <typename V, bool Aligned, typename T>
+TILEDARRAY_SIMD_TARGET void apply(Scale, const std::size_t n, const T a,
+                                  const T* const,
+                                  T* MADNESS_RESTRICT const y) {
+  const auto va = V::set1(a);
+  std::size_t i = 0ul;
+  for (; i + V::width <= n; i += V::width)
+    V::template store<Aligned>(y + i,
+                               V::mul(V::template load<Aligned>(y + i), va));
+  for (; i < n; ++i) y[i] *= a;
+}
+
+template <typename V, bool Aligned, typename T>
+TILEDARRAY_SIMD_TARGET void apply(Axpy, const std::size_t n, const T a,
+                                  const T* MADNESS_RESTRICT const x,
+                                  T* MADNESS_RESTRICT const y) {
+  const auto va = V::set1(a);
+  std::size_t i = 0ul;
+  for (; i + V::width <= n; i += V::width)
+    V::template store<Aligned>(
+        y + i, V::fmadd(va, V::template load<Aligned>(x + i),
+                        V::template load<Aligned>(y + i)));
+  for (; i < n; ++i) y[i] += a * x[i];
+}
+
+template <typename V, bool Aligned, typename T>
+TILEDARRAY_SIMD_TARGET void apply(Add, const std::size_t n, const T,
+                                  const T* MADNESS_RESTRICT const x,
+                                  T* MADNESS_RESTRICT const y) {
+  std::size_t i = 0ul;
+  for (; i + V::width <= n; i += V::width)
+    V::template store<Aligned>(y + i,
+                               V::add(V::template load<Aligned>(y + i),
+                                      V::template load<Aligned>(x + i)));
+  for (; i < n; ++i) y[i] += x[i];
+}
+
+template <typename V, bool Aligned, typename T>
+TILEDARRAY_SIMD_TARGET void apply(Subt, const std::size_t n, const T,
+                                  const T* MADNESS_RESTRICT const x,
+                                  T* MADNESS_RESTRICT const y) {
+  std::size_t i = 0ul;
+  for (; i + V::width <= n; i += V::width)
+    V::template store<Aligned>(y + i,
+                               V::sub(V::template load<Aligned>(y + i),
+                                      V::template load<Aligned>(x + i)));
+  for (; i < n; ++i) y[i] -= x[i];
+}
+
+template <typename V, bool Aligned, typename T>
+TILEDARRAY_SIMD_TARGET void apply(Mult, const std::size_t n, const T,
+                                  const T* MADNESS_RESTRICT const x,
+                                  T* MADNESS_RESTRICT const y) {
+  std::size_t i = 0ul;
+  for (; i + V::width <= n; i += V::width)
+    V::template store<Aligned>(y + i,
+                               V::mul(V::template load<Aligned>(y + i),
+                                      V::template load<Aligned>(x + i)));
+  for (; i < n; ++i) y[i] *= x[i];
+}
+
+template <typename V, bool Aligned, typename T>
+TILEDARRAY_SIMD_TARGET T apply(Dot, const std::size_t n, const T,
+                               const T* const x, const T* const y) {
+  // two accumulators hide the latency of the fused multiply-add
+  auto acc0 = V::set1(T(0));
+  auto acc1 = acc0;
+  std::size_t i = 0ul;
+  for (; i + 2ul * V::width <= n; i += 2ul * V::width) {
+    acc0 = V::fmadd(V::template load<Aligned>(x + i),
+                    V::template load<Aligned>(y + i), acc0);
+    acc1 = V::fmadd(V::template load<Aligned>(x + i + V::width),
+                    V::template load<Aligned>(y + i + V::width), acc1);
+  }
+  for (; i + V::width <= n; i += V::width)
+    acc0 = V::fmadd(V::template load<Aligned>(x + i),
+                    V::template load<Aligned>(y + i), acc0);
+  T result = V::sum(V::add(acc0, acc1));
+  for (; i < n; ++i) result += x[i] * y[i];
+  return result;
+}
+
+template <typename V, bool Aligned, typename T>
+TILEDARRAY_SIMD_TARGET T apply(SquaredNorm, const std::size_t n, const T a,
+                               const T* const x, const T* const) {
+  return apply<V, Aligned>(Dot{}, n, a, x, x);
+}
+
+template <typename V, bool Aligned, typename T>
+TILEDARRAY_SIMD_TARGET T apply(AbsMax, const std::size_t n, const T,
+                               const T* const x, const T* const) {
+  auto acc0 = V::set1(T(0));
+  auto acc1 = acc0;
+  std::size_t i = 0ul;
+  for (; i + 2ul * V::width <= n; i += 2ul * V::width) {
+    acc0 = V::max(acc0, V::abs(V::template load<Aligned>(x + i)));
+    acc1 = V::max(acc1, V::abs(V::template load<Aligned>(x + i + V::width)));
+  }
+  for (; i + V::width <= n; i += V::width)
+    acc0 = V::max(acc0, V::abs(V::template load<Aligned>(x + i)));
+  T result = V::reduce_max(V::max(acc0, acc1));
+  for (; i < n; ++i) result = std::max(result, std::abs(x[i]));
+  return result;
+}
+
+/// Run a kernel with aligned loads if the arguments permit it
+
+/// \tparam V The vector traits
+/// \tparam Kernel The kernel tag
+template <typename V, typename Kernel, typename T, typename Y>
+TILEDARRAY_SIMD_TARGET auto invoke(const std::size_t n, const T a,
+                                   const T* const x, Y* const y) {
+  constexpr std::uintptr_t mask = V::alignment - 1ul;
+  if (((reinterpret_cast<std::uintptr_t>(x) |
+        reinterpret_cast<std::uintptr_t>(y)) &
+       mask) == 0ul)
+    return apply<V, true>(Kernel{}, n, a, x, y);
+  return apply<V, false>(Kernel{}, n, a, x, y);
+}
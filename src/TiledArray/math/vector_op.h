@@ -28,6 +28,7 @@
 
 #include <TiledArray/config.h>
 #include <TiledArray/external/madness.h>
+#include <TiledArray/math/parallel.h>
 
 #if HAVE_INTEL_TBB
 #include <tbb/parallel_for.h>
@@ -408,7 +409,10 @@ void inplace_vector_op(Op&& op, const std::size_t n, Result* const result,
 
   tbb::parallel_for(range, apply_inplace_vector_op, tbb::auto_partitioner());
 #else
-  inplace_vector_op_serial(op, n, result, args...);
+  parallel_for(n, [&](const std::size_t first, const std::size_t last) {
+    inplace_vector_op_serial(op, last - first, result + first,
+                             (args + first)...);
+  });
 #endif
 }
 
@@ -488,7 +492,9 @@ void vector_op(Op&& op, const std::size_t n, Result* const result,
 
   tbb::parallel_for(range, apply_vector_op, tbb::auto_partitioner());
 #else
-  vector_op_serial(op, n, result, args...);
+  parallel_for(n, [&](const std::size_t first, const std::size_t last) {
+    vector_op_serial(op, last - first, result + first, (args + first)...);
+  });
 #endif
 }
 
@@ -554,7 +560,9 @@ void vector_ptr_op(Op&& op, const std::size_t n, Result* const result,
       ApplyVectorPtrOp<Op, Result, Args...>(op, result, args...);
   tbb::parallel_for(range, apply_vector_ptr_op, tbb::auto_partitioner());
 #else
-  vector_ptr_op_serial(op, n, result, args...);
+  parallel_for(n, [&](const std::size_t first, const std::size_t last) {
+    vector_ptr_op_serial(op, last - first, result + first, (args + first)...);
+  });
 #endif
 }
 
@@ -638,7 +646,17 @@ void reduce_op(ReduceOp&& reduce_op, JoinOp&& join_op, const Result& identity,
 
   result = apply_reduce_op.result();
 #else
-  reduce_op_serial(reduce_op, n, result, args...);
+  result = parallel_reduce<Result>(
+      n,
+      [&](const std::size_t first, const std::size_t last) {
+        Result partial = (first == 0ul ? result : identity);
+        reduce_op_serial(reduce_op, last - first, partial, (args + first)...);
+        return partial;
+      },
+      [&](Result left, const Result& right) {
+        join_op(left, right);
+        return left;
+      });
 #endif
 }
 
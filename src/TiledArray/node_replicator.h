@@ -0,0 +1,206 @@
+/*
+ *  This file is a part of TiledArray.
+ *  Copyright (C) 2026  Virginia Tech
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *  node_replicator.h
+ *  October 19, 2026
+ *
+ */
+
+#ifndef TILEDARRAY_NODE_REPLICATOR_H__INCLUDED
+#define TILEDARRAY_NODE_REPLICATOR_H__INCLUDED
+
+#include <TiledArray/error.h>
+#include <TiledArray/external/madness.h>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <atomic>
+#include <climits>
+#include <cstring>
+#include <string>
+#include <vector>
+
+namespace TiledArray {
+namespace detail {
+
+/// The ranks of a World grouped by shared-memory node
+
+/// \note The constructor is collective over the World
+class NodeTopology {
+ private:
+  SafeMPI::Intracomm node_comm_;  ///< The ranks of this node
+  /// The first ranks of the nodes, if this rank is one of them; otherwise
+  /// the other ranks
+  SafeMPI::Intracomm leaders_comm_;
+  bool is_leader_;           ///< This rank is the first rank of its node
+  int node_ = 0;             ///< The index of this node
+  int nnodes_ = 0;           ///< The number of nodes
+  std::vector<int> node_of_;  ///< The node of each world rank
+
+ public:
+  /// \param world The World whose ranks are grouped
+  explicit NodeTopology(World& world)
+      : node_comm_(world.mpi.comm().Split_type(
+            SafeMPI::Intracomm::SHARED_SPLIT_TYPE, world.rank())),
+        leaders_comm_(world.mpi.comm().Split(
+            (node_comm_.Get_rank() == 0 ? 0 : 1), world.rank())),
+        is_leader_(node_comm_.Get_rank() == 0) {
+    // The nodes are numbered by the ranks of their leaders
+    int node_nnodes[2] = {0, 0};
+    if (is_leader_) {
+      node_nnodes[0] = leaders_comm_.Get_rank();
+      node_nnodes[1] = leaders_comm_.Get_size();
+    }
+    node_comm_.Bcast(node_nnodes, 2, MPI_INT, 0);
+    node_ = node_nnodes[0];
+    nnodes_ = node_nnodes[1];
+
+    node_of_.resize(world.size(), 0);
+    node_of_[world.rank()] = node_;
+    world.gop.sum(node_of_.data(), node_of_.size());
+  }
+
+  NodeTopology(const NodeTopology&) = delete;
+  NodeTopology& operator=(const NodeTopology&) = delete;
+
+  /// \return The communicator of the ranks of this node
+  const SafeMPI::Intracomm& node_comm() const { return node_comm_; }
+
+  /// \return The communicator of the node leaders, in node order; only valid
+  /// if this rank is a leader
+  const SafeMPI::Intracomm& leaders_comm() const {
+    TA_ASSERT(is_leader_);
+    return leaders_comm_;
+  }
+
+  /// \return \c true if this rank is the leader of its node
+  bool is_leader() const { return is_leader_; }
+
+  /// \return The index of this node
+  int node() const { return node_; }
+
+  /// \return The number of nodes
+  int nnodes() const { return nnodes_; }
+
+  /// \param rank A world rank
+  /// \return The index of the node of \c rank
+  int node_of(const ProcessID rank) const { return node_of_[rank]; }
+
+};  // class NodeTopology
+
+/// A POSIX shared memory segment mapped by all ranks of a node
+
+/// The leader of the node creates the segment, and unlinks it once all ranks
+/// of the node have mapped it, so the segment is released when the last rank
+/// unmaps it (i.e. destroys this object); the destructor is not collective.
+/// The memory of the segment is reserved when it is created, so running out
+/// of shared memory (e.g. a small \c /dev/shm ) is detected here, instead of
+/// raising \c SIGBUS when the segment is written.
+class NodeSharedMemory {
+ private:
+  void* data_ = nullptr;  ///< The address of the mapping
+  std::size_t size_ = 0;  ///< The size of the segment, in bytes
+
+ public:
+  /// \param topology The node topology
+  /// \param size The size of the segment, in bytes
+  /// \note This is a collective operation over the ranks of the node; if the
+  /// segment cannot be created or mapped, data() is \c nullptr on the
+  /// affected ranks
+  NodeSharedMemory(const NodeTopology& topology, const std::size_t size)
+      : size_(std::max<std::size_t>(size, 1ul)) {
+    static std::atomic<unsigned long> counter{0ul};
+    const SafeMPI::Intracomm& comm = topology.node_comm();
+
+    // An empty name tells the other ranks that the leader failed
+    char name[64] = {};
+    int fd = -1;
+    if (topology.is_leader()) {
+      const std::string n = "/TiledArray." + std::to_string(::getpid()) + "." +
+                            std::to_string(counter++);
+      fd = ::shm_open(n.c_str(), O_CREAT | O_EXCL | O_RDWR, 0600);
+      if (fd != -1 && ::posix_fallocate(fd, 0, size_) == 0)
+        std::strncpy(name, n.c_str(), sizeof(name) - 1);
+      else if (fd != -1) {
+        ::close(fd);
+        fd = -1;
+        ::shm_unlink(n.c_str());
+      }
+    }
+    comm.Bcast(name, sizeof(name), MPI_CHAR, 0);
+    if (name[0] == '\0') return;
+
+    if (!topology.is_leader()) fd = ::shm_open(name, O_RDWR, 0);
+    void* data = MAP_FAILED;
+    if (fd != -1) {
+      data = ::mmap(nullptr, size_, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+      ::close(fd);
+    }
+    comm.Barrier();
+    if (topology.is_leader()) ::shm_unlink(name);
+    if (data != MAP_FAILED) data_ = data;
+  }
+
+  NodeSharedMemory(const NodeSharedMemory&) = delete;
+  NodeSharedMemory& operator=(const NodeSharedMemory&) = delete;
+
+  ~NodeSharedMemory() {
+    if (data_) ::munmap(data_, size_);
+  }
+
+  /// \return The address of the segment, or \c nullptr if it could not be
+  /// created or mapped
+  void* data() const { return data_; }
+
+  /// Make the mapping of this rank read-only
+  void protect() { ::mprotect(data_, size_, PROT_READ); }
+
+};  // class NodeSharedMemory
+
+/// Gather the segments of the node leaders
+
+/// Each node leader holds its own segment of \p data ; afterwards every
+/// leader holds all segments. Ranks that are not leaders do nothing.
+/// \param topology The node topology
+/// \param[in,out] data The segments, contiguous in node order
+/// \param node_begin The offset of the segment of each node, in bytes, and
+/// the total size as the last element
+inline void allgather_node_segments(
+    const NodeTopology& topology, unsigned char* data,
+    const std::vector<std::size_t>& node_begin) {
+  if (!topology.is_leader() || topology.nnodes() == 1) return;
+
+  // Each leader broadcasts its segment, in pieces whose sizes fit in the
+  // int counts of MPI
+  const std::size_t max_count = INT_MAX;
+  const SafeMPI::Intracomm& comm = topology.leaders_comm();
+  for (int n = 0; n < topology.nnodes(); ++n) {
+    for (std::size_t first = node_begin[n]; first < node_begin[n + 1];
+         first += max_count) {
+      const std::size_t count = std::min(node_begin[n + 1] - first, max_count);
+      comm.Bcast(data + first, int(count), MPI_BYTE, n);
+    }
+  }
+}
+
+}  // namespace detail
+}  // namespace TiledArray
+
+#endif  // TILEDARRAY_NODE_REPLICATOR_H__INCLUDED
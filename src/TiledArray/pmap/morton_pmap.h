@@ -0,0 +1,211 @@
+/*
+ *  This file is a part of TiledArray.
+ *  Copyright (C) 2026  Virginia Tech
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *  morton_pmap.h
+ *  October 19, 2026
+ *
+ */
+
+#ifndef TILEDARRAY_PMAP_MORTON_PMAP_H__INCLUDED
+#define TILEDARRAY_PMAP_MORTON_PMAP_H__INCLUDED
+
+#include <TiledArray/pmap/pmap.h>
+
+#include <algorithm>
+#include <numeric>
+#include <vector>
+
+namespace TiledArray {
+namespace detail {
+
+/// A space-filling-curve process map
+
+/// Tiles of an N-dimensional tile grid are ordered along the Morton (Z-order)
+/// curve, and the curve is cut into \c procs contiguous segments that contain
+/// approximately size/procs tiles each (as in BlockedPmap). Tiles that are
+/// close to each other in the tile grid therefore tend to be owned by the same
+/// process, while the load remains balanced. The position of a tile on the
+/// curve (restricted to the tile grid) is computed in O(N<sup>2</sup> log
+/// extent) operations, where N is the rank of the grid, so the map requires
+/// neither communication nor O(size) storage; only the list of local tiles is
+/// cached.
+class MortonPmap : public Pmap {
+ protected:
+  // Import Pmap protected variables
+  using Pmap::local_;  ///< The list of local tiles
+  using Pmap::procs_;  ///< The number of processes
+  using Pmap::rank_;   ///< The rank of this process
+  using Pmap::size_;   ///< The number of tiles mapped among all processes
+
+ private:
+  std::vector<size_type> extents_;  ///< Extents of the tile grid
+  size_type nbits_ = 0ul;  ///< Number of bits needed to encode a coordinate
+  size_type block_size_ = 0ul;  ///< Curve segment size (= size_ / procs_)
+  size_type remainder_ = 0ul;   ///< Curve remainder (= size_ % procs_)
+
+ public:
+  typedef Pmap::size_type size_type;  ///< Size type
+
+  /// Construct a Morton-ordered process map
+
+  /// \tparam Extents a sequence of integers
+  /// \param world The world where the tiles will be mapped
+  /// \param extents The extents of the tile grid; tile ordinals are the
+  ///        row-major ordinals of this grid
+  template <typename Extents>
+  MortonPmap(World& world, const Extents& extents)
+      : Pmap(world, volume(extents)),
+        extents_(std::begin(extents), std::end(extents)),
+        block_size_(size_ / procs_),
+        remainder_(size_ % procs_) {
+    TA_ASSERT(!extents_.empty());
+    const size_type max_extent =
+        *std::max_element(extents_.begin(), extents_.end());
+    while ((size_type(1) << nbits_) < max_extent) ++nbits_;
+
+    // Decode the local segment of the curve
+    const size_type first =
+        rank_ * block_size_ + std::min<size_type>(rank_, remainder_);
+    const size_type last = (rank_ + 1ul) * block_size_ +
+                           std::min<size_type>(rank_ + 1ul, remainder_);
+    local_.reserve(last - first);
+    for (size_type pos = first; pos < last; ++pos)
+      local_.push_back(curve_to_ordinal(pos));
+    std::sort(local_.begin(), local_.end());
+    this->local_size_ = local_.size();
+  }
+
+  virtual ~MortonPmap() {}
+
+  /// Tile grid extents accessor
+
+  /// \return The extents of the tile grid
+  const std::vector<size_type>& extents() const { return extents_; }
+
+  /// Maps \c tile to the processor that owns it
+
+  /// \param tile The tile to be queried
+  /// \return Processor that logically owns \c tile
+  virtual size_type owner(const size_type tile) const {
+    TA_ASSERT(tile < size_);
+    const size_type pos = ordinal_to_curve(tile);
+    const size_type block_size_plus_1 = block_size_ + 1ul;
+    const size_type block_size_plus_1_times_remainder =
+        remainder_ * block_size_plus_1;
+    return (pos < block_size_plus_1_times_remainder
+                ? pos / block_size_plus_1
+                : ((pos - block_size_plus_1_times_remainder) / block_size_) +
+                      remainder_);
+  }
+
+  /// Check that the tile is owned by this process
+
+  /// \param tile The tile to be checked
+  /// \return \c true if \c tile is owned by this process, otherwise \c false .
+  virtual bool is_local(const size_type tile) const {
+    return MortonPmap::owner(tile) == rank_;
+  }
+
+ private:
+  template <typename Extents>
+  static size_type volume(const Extents& extents) {
+    size_type result = 1ul;
+    for (auto&& e : extents) result *= e;
+    return result;
+  }
+
+  /// Number of grid points in the cell [lo,hi)
+
+  /// \param lo The lower bound of the cell
+  /// \param hi The upper bound of the cell
+  /// \return The number of tiles of the grid that lie in the cell
+  size_type cell_volume(const std::vector<size_type>& lo,
+                        const std::vector<size_type>& hi) const {
+    size_type result = 1ul;
+    for (size_type d = 0ul; d < extents_.size(); ++d) {
+      const size_type h = std::min(hi[d], extents_[d]);
+      if (h <= lo[d]) return 0ul;
+      result *= h - lo[d];
+    }
+    return result;
+  }
+
+  /// Position of a tile on the Morton curve restricted to the tile grid
+
+  /// Descends the curve one interleaved bit at a time (most significant level
+  /// first, dimension 0 first within a level), counting the tiles of the grid
+  /// that precede \p tile.
+  /// \param tile The row-major tile ordinal
+  /// \return The number of tiles that precede \p tile on the curve
+  size_type ordinal_to_curve(size_type tile) const {
+    const size_type rank = extents_.size();
+    std::vector<size_type> coord(rank);
+    for (size_type d = rank; d > 0ul; --d) {
+      coord[d - 1ul] = tile % extents_[d - 1ul];
+      tile /= extents_[d - 1ul];
+    }
+
+    std::vector<size_type> lo(rank, 0ul), hi(rank, size_type(1) << nbits_);
+    size_type pos = 0ul;
+    for (size_type b = nbits_; b > 0ul; --b) {
+      for (size_type d = 0ul; d < rank; ++d) {
+        const size_type mid = lo[d] + (size_type(1) << (b - 1ul));
+        const size_type upper = hi[d];
+        hi[d] = mid;
+        if (coord[d] >= mid) {
+          pos += cell_volume(lo, hi);
+          hi[d] = upper;
+          lo[d] = mid;
+        }
+      }
+    }
+    return pos;
+  }
+
+  /// Tile at a given position of the Morton curve restricted to the tile grid
+
+  /// Inverse of ordinal_to_curve()
+  /// \param pos The position on the curve, <tt>pos < size()</tt>
+  /// \return The row-major ordinal of the tile at position \p pos
+  size_type curve_to_ordinal(size_type pos) const {
+    TA_ASSERT(pos < size_);
+    const size_type rank = extents_.size();
+    std::vector<size_type> lo(rank, 0ul), hi(rank, size_type(1) << nbits_);
+    for (size_type b = nbits_; b > 0ul; --b) {
+      for (size_type d = 0ul; d < rank; ++d) {
+        const size_type mid = lo[d] + (size_type(1) << (b - 1ul));
+        const size_type upper = hi[d];
+        hi[d] = mid;
+        const size_type lower_volume = cell_volume(lo, hi);
+        if (pos >= lower_volume) {
+          pos -= lower_volume;
+          hi[d] = upper;
+          lo[d] = mid;
+        }
+      }
+    }
+
+    size_type tile = 0ul;
+    for (size_type d = 0ul; d < rank; ++d) tile = tile * extents_[d] + lo[d];
+    return tile;
+  }
+};  // class MortonPmap
+
+}  // namespace detail
+}  // namespace TiledArray
+
+#endif  // TILEDARRAY_PMAP_MORTON_PMAP_H__INCLUDED
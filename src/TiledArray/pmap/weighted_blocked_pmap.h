@@ -0,0 +1,129 @@
+/*
+ *  This file is a part of TiledArray.
+ *  Copyright (C) 2026  Virginia Tech
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *  weighted_blocked_pmap.h
+ *  October 19, 2026
+ *
+ */
+
+#ifndef TILEDARRAY_PMAP_WEIGHTED_BLOCKED_PMAP_H__INCLUDED
+#define TILEDARRAY_PMAP_WEIGHTED_BLOCKED_PMAP_H__INCLUDED
+
+#include <TiledArray/pmap/pmap.h>
+
+#include <algorithm>
+#include <vector>
+
+namespace TiledArray {
+namespace detail {
+
+/// A cost-driven blocked process map
+
+/// Map N elements among P processes into contiguous blocks such that the sum
+/// of the element costs in each block is approximately 1/P of the total cost.
+/// The costs are typically measured (e.g. per-tile task times or tile norms
+/// of a previous iteration) and must be identical on all processes, e.g.
+/// reduced with \c World::gop.sum() . Only the P+1 block boundaries are
+/// stored; the owner is found by binary search.
+class WeightedBlockedPmap : public Pmap {
+ protected:
+  // Import Pmap protected variables
+  using Pmap::procs_;  ///< The number of processes
+  using Pmap::rank_;   ///< The rank of this process
+  using Pmap::size_;   ///< The number of tiles mapped among all processes
+
+ private:
+  std::vector<size_type> bounds_;  ///< First tile of each process's block
+  size_type local_first_ = 0ul;    ///< First tile of this process's block
+  size_type local_last_ = 0ul;     ///< Last tile + 1 of this process's block
+
+ public:
+  typedef Pmap::size_type size_type;  ///< Key type
+
+  /// Construct cost-driven blocked map
+
+  /// \tparam Costs a sequence of nonnegative numbers
+  /// \param world The world where the tiles will be mapped
+  /// \param costs The cost of each tile; the number of tiles to be mapped is
+  ///        the size of \p costs
+  template <typename Costs>
+  WeightedBlockedPmap(World& world, const Costs& costs)
+      : Pmap(world, std::size(costs)), bounds_(procs_ + 1ul, size_) {
+    double total = 0.0;
+    for (auto&& c : costs) {
+      TA_ASSERT(c >= 0);
+      total += c;
+    }
+
+    // Place the p-th boundary where the cost prefix sum reaches p/P of the
+    // total (a tile starts the next block if its midpoint lies past the
+    // target); if all costs vanish, fall back to an even split by count
+    bounds_[0] = 0ul;
+    size_type p = 1ul;
+    double prefix = 0.0;
+    size_type tile = 0ul;
+    for (auto&& c : costs) {
+      while (p < procs_ &&
+             (total > 0.0
+                  ? prefix + 0.5 * c >= total * double(p) / double(procs_)
+                  : tile * procs_ >= size_ * p))
+        bounds_[p++] = tile;
+      prefix += c;
+      ++tile;
+    }
+
+    local_first_ = bounds_[rank_];
+    local_last_ = bounds_[rank_ + 1ul];
+    this->local_size_ = local_last_ - local_first_;
+  }
+
+  virtual ~WeightedBlockedPmap() {}
+
+  /// Maps \c tile to the processor that owns it
+
+  /// \param tile The tile to be queried
+  /// \return Processor that logically owns \c tile
+  virtual size_type owner(const size_type tile) const {
+    TA_ASSERT(tile < size_);
+    // the owner is the last process whose block begins at or before tile
+    return std::distance(bounds_.begin(), std::upper_bound(bounds_.begin(),
+                                                           bounds_.end() - 1,
+                                                           tile)) -
+           1;
+  }
+
+  /// Check that the tile is owned by this process
+
+  /// \param tile The tile to be checked
+  /// \return \c true if \c tile is owned by this process, otherwise \c false .
+  virtual bool is_local(const size_type tile) const {
+    return ((tile >= local_first_) && (tile < local_last_));
+  }
+
+  virtual const_iterator begin() const {
+    return Iterator(*this, local_first_, local_last_, local_first_, false);
+  }
+  virtual const_iterator end() const {
+    return Iterator(*this, local_first_, local_last_, local_last_, false);
+  }
+
+};  // class WeightedBlockedPmap
+
+}  // namespace detail
+}  // namespace TiledArray
+
+#endif  // TILEDARRAY_PMAP_WEIGHTED_BLOCKED_PMAP_H__INCLUDED
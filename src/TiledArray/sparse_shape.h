@@ -658,6 +658,35 @@ class SparseShape {
                         my_threshold_);
   }
 
+  /// Screen out the tiles whose norms are below a threshold
+
+  /// Unlike constructing a new shape from tile norms, this reuses the
+  /// (already scaled and replicated) norms of this shape, so no tile data is
+  /// read and no communication is needed; only the norms of the newly
+  /// zeroed tiles and the zero tile count are updated.
+  /// \param thresh The threshold (per-element norm) below which tiles are
+  /// considered to be zero
+  /// \return A copy of this shape without the tiles whose norms are below
+  /// \p thresh \post `result.init_threshold() == thresh`
+  SparseShape_ truncate(const value_type thresh) const {
+    TA_ASSERT(!tile_norms_.empty());
+    TA_ASSERT(thresh >= value_type(0));
+
+    madness::AtomicInt zero_tile_count;
+    zero_tile_count = zero_tile_count_;
+    Tensor<value_type> result_tile_norms =
+        tile_norms_.unary([thresh, &zero_tile_count](value_type n) {
+          if (n != value_type(0) && n < thresh) {
+            n = value_type(0);
+            ++zero_tile_count;
+          }
+          return n;
+        });
+
+    return SparseShape_(result_tile_norms, size_vectors_, zero_tile_count,
+                        thresh);
+  }
+
   // clang-format off
   /// Creates a copy of this with a sub-block updated with contents of another shape
 
@@ -31,6 +31,8 @@
 #include <TiledArray/tensor.h>
 #include <TiledArray/tiled_range.h>
 
+#include <algorithm>
+#include <cmath>
 #include <vector>
 
 namespace TiledArray {
@@ -300,6 +302,87 @@ diagonal_array(World &world, TiledRange const &trange,
   abort();  // unreachable
 }
 
+/// \brief Multiplies a mode of a DistArray by a diagonal matrix
+
+/// Computes the product of \p A with the diagonal matrix whose diagonal
+/// elements are given by an input range over mode \p mode of \p A , e.g.
+/// for mode 1 of a matrix the result is the same as that of
+/// \code
+/// D = diagonal_array<Array>(world, TiledRange{A.trange().dim(1),
+///                                             A.trange().dim(1)},
+///                           diagonals_begin);
+/// result("i,j") = A("i,k") * D("k,j");
+/// \endcode
+/// but the elements of \p A are scaled directly, without diagonal tiles or
+/// GEMMs. The result has the same TiledRange and distribution as \p A .
+/// \tparam Array a DistArray type
+/// \tparam RandomAccessIterator an iterator over the range of diagonal elements
+/// \param[in] A The array to be scaled
+/// \param[in] mode The mode of \p A that is multiplied by the diagonal matrix
+/// \param[in] diagonals_begin the begin iterator of the range of the
+/// diagonals; element \c n of mode \p mode is scaled by
+/// <tt>*(diagonals_begin + n)</tt>
+/// \return the scaled array
+template <typename Array, typename RandomAccessIterator>
+std::enable_if_t<detail::is_iterator<RandomAccessIterator>::value, Array>
+diagonal_scale(const Array &A, const unsigned int mode,
+               RandomAccessIterator diagonals_begin) {
+  using Policy = typename Array::policy_type;
+  using Tile = typename Array::value_type;
+  const auto &trange = A.trange();
+  TA_ASSERT(mode < trange.rank());
+
+  Array result;
+  if constexpr (is_dense_v<Policy>) {
+    result = Array(A.world(), trange, A.pmap());
+  } else {
+    // Scale the (per-element) tile norms by the largest diagonal element of
+    // each tile of the scaled mode
+    const auto &tr1 = trange.dim(mode);
+    std::vector<float> max_abs;
+    for (auto t = tr1.tiles_range().first; t != tr1.tiles_range().second; ++t) {
+      float m = 0;
+      for (auto n = tr1.tile(t).first; n != tr1.tile(t).second; ++n)
+        m = std::max<float>(m, std::abs(*(diagonals_begin + n)));
+      max_abs.push_back(m);
+    }
+    using ShapeType = typename Policy::shape_type;
+    const auto &tiles = trange.tiles_range();
+    Tensor<float> shape_norm(tiles);
+    for (auto &&idx : tiles)
+      shape_norm(idx) =
+          A.shape()[idx] * max_abs[idx[mode] - tr1.tiles_range().first];
+    result = Array(A.world(), trange, ShapeType(shape_norm, trange, true),
+                   A.pmap());
+  }
+
+  for (auto &&ord : *result.pmap()) {
+    if (result.is_zero(ord)) continue;
+    result.set(
+        ord, result.world().taskq.add(
+                 [mode, diagonals_begin](const Tile &arg) {
+                   const auto &range = arg.range();
+                   // The elements are scaled in blocks of inner elements with
+                   // the same index of the scaled mode
+                   std::size_t inner = 1;
+                   for (auto d = mode + 1; d < range.rank(); ++d)
+                     inner *= range.extent(d);
+                   const auto extent = range.extent(mode);
+                   const auto lo = range.lobound(mode);
+                   Tile tile = arg.clone();
+                   auto *data = tile.data();
+                   for (std::size_t i = 0; i < range.volume(); i += inner)
+                     std::transform(data + i, data + i + inner, data + i,
+                                    [s = *(diagonals_begin + lo +
+                                           (i / inner) % extent)](
+                                        const auto &x) { return x * s; });
+                   return tile;
+                 },
+                 A.find_local(ord)));
+  }
+  return result;
+}
+
 }  // namespace TiledArray
 
 #endif  // TILEDARRAY_SPECIALARRAYS_DIAGONAL_ARRAY_H__INCLUDED
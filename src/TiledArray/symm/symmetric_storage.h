@@ -0,0 +1,334 @@
+/*
+ *  This file is a part of TiledArray.
+ *  Copyright (C) 2026  Virginia Tech
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *  symmetric_storage.h
+ *  October 19, 2026
+ *
+ */
+
+#ifndef TILEDARRAY_SYMM_SYMMETRIC_STORAGE_H__INCLUDED
+#define TILEDARRAY_SYMM_SYMMETRIC_STORAGE_H__INCLUDED
+
+#include <TiledArray/dist_array.h>
+#include <TiledArray/symm/permutation.h>
+#include <TiledArray/tile_interface/permute.h>
+#include <TiledArray/tile_interface/scale.h>
+
+#include <algorithm>
+#include <numeric>
+#include <tuple>
+#include <vector>
+
+namespace TiledArray {
+namespace symmetry {
+
+/// Permutational symmetry of the modes of a tensor
+
+/// Describes a tensor that is symmetric or antisymmetric under the
+/// permutations of the modes within each of several disjoint mode sets, i.e.
+/// whose symmetry group is the direct product of the symmetric groups of the
+/// mode sets. For example, the coupled-cluster doubles amplitudes
+/// \f$ t^{ab}_{ij} \f$ are antisymmetric in \c {0,1} and in \c {2,3} :
+/// \code
+/// auto sym = PermutationalSymmetry().antisymmetric({0, 1})
+///                                   .antisymmetric({2, 3});
+/// \endcode
+/// The modes of a set must have the same tiling. A tile is \em unique if its
+/// tile indices do not decrease within each set; every other tile is, up to
+/// a sign, a permutation of a unique tile (see canonical() ).
+class PermutationalSymmetry {
+ public:
+  typedef unsigned int mode_type;
+  typedef std::vector<mode_type> modes_type;
+  typedef Range::index_type index_type;
+
+ private:
+  std::vector<std::pair<modes_type, int>> sets_;  ///< Mode sets and signs
+
+  PermutationalSymmetry& add(modes_type modes, const int sign) {
+    std::sort(modes.begin(), modes.end());
+    TA_ASSERT(std::adjacent_find(modes.begin(), modes.end()) == modes.end());
+    for (const auto& set : sets_)
+      for (const auto m : modes)
+        TA_ASSERT(std::find(set.first.begin(), set.first.end(), m) ==
+                  set.first.end());
+    if (modes.size() > 1ul) sets_.emplace_back(std::move(modes), sign);
+    return *this;
+  }
+
+  /// Stable order of the tile indices of a mode set
+  template <typename Index>
+  static std::vector<mode_type> order(const modes_type& modes,
+                                      const Index& idx) {
+    std::vector<mode_type> result(modes.size());
+    std::iota(result.begin(), result.end(), 0u);
+    std::stable_sort(result.begin(), result.end(),
+                     [&](const mode_type i, const mode_type j) {
+                       return idx[modes[i]] < idx[modes[j]];
+                     });
+    return result;
+  }
+
+ public:
+  PermutationalSymmetry() = default;
+
+  /// Add a set of symmetric modes
+
+  /// \param modes The modes, which must not be in another set
+  /// \return A reference to this object
+  PermutationalSymmetry& symmetric(modes_type modes) {
+    return add(std::move(modes), 1);
+  }
+
+  /// Add a set of antisymmetric modes
+
+  /// \param modes The modes, which must not be in another set
+  /// \return A reference to this object
+  PermutationalSymmetry& antisymmetric(modes_type modes) {
+    return add(std::move(modes), -1);
+  }
+
+  /// \return The mode sets and their signs (1 if symmetric, -1 if
+  /// antisymmetric)
+  const std::vector<std::pair<modes_type, int>>& sets() const { return sets_; }
+
+  /// Check that a tiled range is compatible with this symmetry
+
+  /// \param trange The tiled range
+  /// \return \c true if the modes of each set have the same tiling
+  bool is_compatible(const TiledRange& trange) const {
+    for (const auto& set : sets_)
+      for (const auto m : set.first)
+        if (m >= trange.rank() || trange.dim(m) != trange.dim(set.first[0]))
+          return false;
+    return true;
+  }
+
+  /// \param idx A tile index
+  /// \return \c true if \c idx is the index of a unique tile
+  template <typename Index>
+  bool is_unique(const Index& idx) const {
+    for (const auto& set : sets_)
+      for (std::size_t k = 1ul; k < set.first.size(); ++k)
+        if (idx[set.first[k - 1]] > idx[set.first[k]]) return false;
+    return true;
+  }
+
+  /// Map a tile to its unique tile
+
+  /// \param idx A tile index
+  /// \return The index of the unique tile \c c , and the permutation \c p
+  /// and sign \c s such that the tile \c idx is <tt>s * permute(tile(c),
+  /// p)</tt>
+  template <typename Index>
+  std::tuple<index_type, TiledArray::Permutation, int> canonical(
+      const Index& idx) const {
+    const auto rank = std::size(idx);
+    index_type c(std::begin(idx), std::end(idx));
+    std::vector<mode_type> p(rank);
+    std::iota(p.begin(), p.end(), 0u);
+    int sign = 1;
+    for (const auto& set : sets_) {
+      const auto& modes = set.first;
+      const auto o = order(modes, idx);
+      for (std::size_t k = 0ul; k < modes.size(); ++k) {
+        c[modes[k]] = idx[modes[o[k]]];
+        p[modes[k]] = modes[o[k]];
+      }
+      if (set.second < 0) {
+        // The parity of a permutation is that of the number of transpositions
+        // of its cycles
+        std::size_t transpositions = 0ul;
+        for (const auto& cycle : Permutation(o).cycles())
+          transpositions += cycle.size() - 1ul;
+        if (transpositions % 2ul) sign = -sign;
+      }
+    }
+    return {std::move(c), TiledArray::Permutation(std::move(p)), sign};
+  }
+
+  /// The number of tiles that are equivalent to a unique tile
+
+  /// \param idx The index of a unique tile
+  /// \param modes The modes over which the permutations are counted; they
+  /// must be a union of mode sets
+  /// \return The number of distinct permutations of \c idx within the mode
+  /// sets that are contained in \c modes
+  template <typename Index>
+  std::size_t orbit_size(const Index& idx, const modes_type& modes) const {
+    std::size_t result = 1ul;
+    for (const auto& set : sets_) {
+      const auto contained = std::count_if(
+          set.first.begin(), set.first.end(), [&](const mode_type m) {
+            return std::find(modes.begin(), modes.end(), m) != modes.end();
+          });
+      if (contained == 0) continue;
+      TA_ASSERT(std::size_t(contained) == set.first.size());
+
+      // The multinomial coefficient n! / (n_1! n_2! ...) , where n_i are the
+      // multiplicities of the tile indices, computed incrementally
+      std::vector<std::size_t> values;
+      for (const auto m : set.first) values.push_back(idx[m]);
+      std::sort(values.begin(), values.end());
+      std::size_t multiplicity = 0ul;
+      for (std::size_t k = 0ul; k < values.size(); ++k) {
+        multiplicity = (k && values[k] == values[k - 1]) ? multiplicity + 1ul
+                                                         : 1ul;
+        result = result * (k + 1ul) / multiplicity;
+      }
+    }
+    return result;
+  }
+
+};  // class PermutationalSymmetry
+
+/// Keep the unique tiles of a symmetric array
+
+/// The result has the tiles, the tiling and the process map of \p A , but
+/// all tiles that are not unique are zero, so only the unique tiles are
+/// stored. The unique tiles are shared with \p A (no data is copied or
+/// communicated).
+/// \tparam Tile The tile type
+/// \tparam Policy The policy type, which must be sparse
+/// \param A An array with the symmetry \p sym
+/// \param sym The symmetry of \p A
+/// \return The packed array
+template <typename Tile, typename Policy>
+DistArray<Tile, Policy> pack(const DistArray<Tile, Policy>& A,
+                             const PermutationalSymmetry& sym) {
+  static_assert(!is_dense_v<Policy>,
+                "TiledArray::symmetry::pack requires a sparse policy");
+  using ShapeType = typename Policy::shape_type;
+  const auto& trange = A.trange();
+  TA_ASSERT(sym.is_compatible(trange));
+
+  Tensor<float> norms = A.shape().data().clone();
+  for (auto&& idx : trange.tiles_range())
+    if (!sym.is_unique(idx)) norms(idx) = 0;
+  DistArray<Tile, Policy> result(A.world(), trange,
+                                 ShapeType(norms, trange, true), A.pmap());
+
+  for (auto&& ord : *result.pmap())
+    if (!result.is_zero(ord)) result.set(ord, A.find_local(ord));
+  return result;
+}
+
+/// Restore all tiles of a packed symmetric array
+
+/// Each tile that is not unique is computed from its unique tile (see
+/// PermutationalSymmetry::canonical() ), which is fetched if it is not local.
+/// \tparam Tile The tile type
+/// \tparam Policy The policy type, which must be sparse
+/// \param packed An array whose unique tiles are those of an array with the
+/// symmetry \p sym (see pack() )
+/// \param sym The symmetry of the array
+/// \return The array with all tiles
+template <typename Tile, typename Policy>
+DistArray<Tile, Policy> unpack(const DistArray<Tile, Policy>& packed,
+                               const PermutationalSymmetry& sym) {
+  static_assert(!is_dense_v<Policy>,
+                "TiledArray::symmetry::unpack requires a sparse policy");
+  using ShapeType = typename Policy::shape_type;
+  const auto& trange = packed.trange();
+  TA_ASSERT(sym.is_compatible(trange));
+
+  const auto& packed_norms = packed.shape().data();
+  Tensor<float> norms(trange.tiles_range());
+  for (auto&& idx : trange.tiles_range())
+    norms(idx) = packed_norms(std::get<0>(sym.canonical(idx)));
+  DistArray<Tile, Policy> result(packed.world(), trange,
+                                 ShapeType(norms, trange, true),
+                                 packed.pmap());
+
+  for (auto&& ord : *result.pmap()) {
+    if (result.is_zero(ord)) continue;
+    auto [c, p, sign] = sym.canonical(trange.tiles_range().idx(ord));
+    if (p == p.identity()) {
+      TA_ASSERT(sign == 1);
+      result.set(ord, packed.find_local(ord));
+      continue;
+    }
+    result.set(ord, result.world().taskq.add(
+                        [p = std::move(p), sign](const Tile& tile) -> Tile {
+                          if (sign < 0) return scale(permute(tile, p), -1);
+                          return permute(tile, p);
+                        },
+                        packed.find(c)));
+  }
+  return result;
+}
+
+/// Weight the unique tiles of a packed array by the size of their orbits
+
+/// Contracting two arrays over a union of mode sets that are (anti)symmetric
+/// in both sums the same product for every permutation of the contracted
+/// tile indices. Hence the contraction of the packed arrays, one of which is
+/// weighted by this function, equals the contraction of the full arrays,
+/// but only the products of unique tiles are computed. For example, with
+/// \c t and \c v antisymmetric in their first and last pairs of modes:
+/// \code
+/// auto t_p = pack(t, sym);
+/// auto v_p = pack(v, sym);
+/// r_p("i,j,a,b") = orbit_weighted(t_p, sym, {2, 3})("i,j,c,d") *
+///                  v_p("c,d,a,b");
+/// \endcode
+/// gives \c r_p , the packed result, with the symmetry \c sym .
+/// \tparam Tile The tile type
+/// \tparam Policy The policy type, which must be sparse
+/// \param packed A packed array (see pack() )
+/// \param sym The symmetry of \p packed
+/// \param modes The contracted modes; they must be a union of mode sets of
+/// \p sym
+/// \return \p packed with each tile scaled by its orbit size over \p modes
+template <typename Tile, typename Policy>
+DistArray<Tile, Policy> orbit_weighted(
+    const DistArray<Tile, Policy>& packed, const PermutationalSymmetry& sym,
+    const PermutationalSymmetry::modes_type& modes) {
+  static_assert(!is_dense_v<Policy>,
+                "TiledArray::symmetry::orbit_weighted requires a sparse "
+                "policy");
+  using ShapeType = typename Policy::shape_type;
+  const auto& trange = packed.trange();
+  TA_ASSERT(sym.is_compatible(trange));
+
+  Tensor<float> norms = packed.shape().data().clone();
+  for (auto&& idx : trange.tiles_range())
+    norms(idx) *= sym.orbit_size(idx, modes);
+  DistArray<Tile, Policy> result(packed.world(), trange,
+                                 ShapeType(norms, trange, true),
+                                 packed.pmap());
+
+  for (auto&& ord : *result.pmap()) {
+    if (result.is_zero(ord)) continue;
+    const auto weight =
+        sym.orbit_size(trange.tiles_range().idx(ord), modes);
+    if (weight == 1ul)
+      result.set(ord, packed.find_local(ord));
+    else
+      result.set(ord, result.world().taskq.add(
+                          [weight](const Tile& tile) -> Tile {
+                            return scale(tile, weight);
+                          },
+                          packed.find_local(ord)));
+  }
+  return result;
+}
+
+}  // namespace symmetry
+}  // namespace TiledArray
+
+#endif  // TILEDARRAY_SYMM_SYMMETRIC_STORAGE_H__INCLUDED
@@ -0,0 +1,732 @@
+/*
+ *  This file is a part of TiledArray.
+ *  Copyright (C) 2026  Virginia Tech
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *  low_rank_tensor.h
+ *  October 19, 2026
+ *
+ */
+
+#ifndef TILEDARRAY_TENSOR_LOW_RANK_TENSOR_H__INCLUDED
+#define TILEDARRAY_TENSOR_LOW_RANK_TENSOR_H__INCLUDED
+
+#include <TiledArray/external/eigen.h>
+#include <TiledArray/math/gemm_helper.h>
+#include <TiledArray/permutation.h>
+#include <TiledArray/range.h>
+#include <TiledArray/tensor.h>
+#include <TiledArray/tensor/type_traits.h>
+
+#include <Eigen/QR>
+#include <Eigen/SVD>
+
+#include <memory>
+
+namespace TiledArray {
+
+/// A matrix tile stored in low-rank (factored) form
+
+/// LowRankTensor represents a rank-2 tile \f$ A \f$ as the product of two
+/// factors, \f$ A = U V^T \f$, where \f$ U \f$ is \f$ m \times r \f$ and
+/// \f$ V \f$ is \f$ n \times r \f$. The rank \f$ r \f$ is selected by a
+/// tolerance: factors are truncated such that the Frobenius norm of the
+/// discarded part does not exceed the tolerance. The tile interface
+/// operations (\c add, \c scale, \c permute, \c gemm, etc.) act directly on
+/// the factors; operations that increase the rank (addition and accumulation)
+/// recompress the result with the tolerance of the tile. These are the
+/// building blocks of block low-rank (BLR) matrices, which are efficient for
+/// matrices with numerically low-rank off-diagonal blocks.
+///
+/// Like Tensor, LowRankTensor is a shallow-copy object; use clone() to
+/// make a deep copy.
+/// \note LowRankTensor is a tile-level type: it is not a tile type of
+/// DistArray expressions (contraction, addition, blocks, etc.), hence this
+/// header is not included by \c tiledarray.h and must be included
+/// explicitly.
+/// \tparam T The element type
+template <typename T>
+class LowRankTensor {
+ public:
+  typedef LowRankTensor<T> LowRankTensor_;  ///< This class type
+  typedef Range range_type;                 ///< Tensor range type
+  typedef typename range_type::ordinal_type
+      size_type;      ///< Size type (to meet the container concept)
+  typedef T value_type;  ///< Element type
+  typedef typename TiledArray::detail::numeric_type<T>::type
+      numeric_type;  ///< the numeric type that supports T
+  typedef typename TiledArray::detail::scalar_type<T>::type
+      scalar_type;  ///< the scalar type that supports T
+  typedef Eigen::Matrix<T, Eigen::Dynamic, Eigen::Dynamic>
+      matrix_type;  ///< Factor matrix type
+
+ private:
+  typedef Eigen::Matrix<T, Eigen::Dynamic, Eigen::Dynamic, Eigen::RowMajor>
+      dense_matrix_type;
+
+  struct Impl {
+    range_type range;  ///< The tile range
+    matrix_type u;     ///< The left-hand factor
+    matrix_type v;     ///< The right-hand factor
+    scalar_type tolerance;  ///< The truncation tolerance
+  };  // struct Impl
+
+  std::shared_ptr<Impl> pimpl_;  ///< Shared pointer to the factors
+
+ public:
+  /// Construct an empty tile
+  LowRankTensor() = default;
+  LowRankTensor(const LowRankTensor_&) = default;
+  LowRankTensor(LowRankTensor_&&) = default;
+  LowRankTensor_& operator=(const LowRankTensor_&) = default;
+  LowRankTensor_& operator=(LowRankTensor_&&) = default;
+  ~LowRankTensor() = default;
+
+  /// Construct a tile from its factors
+
+  /// \param range The range of the tile
+  /// \param u The left-hand factor, a <tt>range.extent(0)</tt> by \c r matrix
+  /// \param v The right-hand factor, a <tt>range.extent(1)</tt> by \c r matrix
+  /// \param tolerance The truncation tolerance used for recompression
+  LowRankTensor(const range_type& range, matrix_type u, matrix_type v,
+                const scalar_type tolerance = scalar_type(0))
+      : pimpl_(std::make_shared<Impl>(
+            Impl{range, std::move(u), std::move(v), tolerance})) {
+    TA_ASSERT(range.rank() == 2u);
+    TA_ASSERT(pimpl_->u.rows() == Eigen::Index(range.extent(0)));
+    TA_ASSERT(pimpl_->v.rows() == Eigen::Index(range.extent(1)));
+    TA_ASSERT(pimpl_->u.cols() == pimpl_->v.cols());
+    TA_ASSERT(tolerance >= scalar_type(0));
+  }
+
+  /// Compress a dense tile
+
+  /// The factors are computed with a truncated singular value decomposition
+  /// of \c tensor .
+  /// \param tensor The rank-2 tensor to be compressed
+  /// \param tolerance The truncation tolerance; the Frobenius norm of the
+  /// difference between \c tensor and the compressed tile does not exceed
+  /// this value
+  LowRankTensor(const Tensor<T>& tensor, const scalar_type tolerance) {
+    TA_ASSERT(!tensor.empty());
+    TA_ASSERT(tensor.range().rank() == 2u);
+    TA_ASSERT(tolerance >= scalar_type(0));
+    const auto m = tensor.range().extent(0);
+    const auto n = tensor.range().extent(1);
+    Eigen::Map<const dense_matrix_type> a(tensor.data(), m, n);
+    Eigen::BDCSVD<matrix_type> svd(a,
+                                   Eigen::ComputeThinU | Eigen::ComputeThinV);
+    const auto r = truncation_rank(svd.singularValues(), tolerance);
+    pimpl_ = std::make_shared<Impl>(Impl{
+        tensor.range(),
+        svd.matrixU().leftCols(r) *
+            svd.singularValues().head(r).template cast<T>().asDiagonal(),
+        svd.matrixV().leftCols(r).conjugate(), tolerance});
+  }
+
+  /// Deep copy
+
+  /// \return A deep copy of this tile
+  LowRankTensor_ clone() const {
+    LowRankTensor_ result;
+    if (pimpl_) result.pimpl_ = std::make_shared<Impl>(*pimpl_);
+    return result;
+  }
+
+  /// Convert to a dense tensor
+
+  /// \return A Tensor that holds the elements of \f$ U V^T \f$
+  explicit operator Tensor<T>() const {
+    TA_ASSERT(pimpl_);
+    Tensor<T> result(pimpl_->range);
+    Eigen::Map<dense_matrix_type> a(result.data(), pimpl_->u.rows(),
+                                    pimpl_->v.rows());
+    if (rank() == 0l)
+      a.setZero();
+    else
+      a.noalias() = pimpl_->u * pimpl_->v.transpose();
+    return result;
+  }
+
+  /// Tile range accessor
+
+  /// \return The range of this tile
+  const range_type& range() const {
+    TA_ASSERT(pimpl_);
+    return pimpl_->range;
+  }
+
+  /// Left-hand factor accessor
+
+  /// \return The \c m by \c r factor \f$ U \f$
+  const matrix_type& u() const {
+    TA_ASSERT(pimpl_);
+    return pimpl_->u;
+  }
+
+  /// Right-hand factor accessor
+
+  /// \return The \c n by \c r factor \f$ V \f$
+  const matrix_type& v() const {
+    TA_ASSERT(pimpl_);
+    return pimpl_->v;
+  }
+
+  /// Rank of the factorization
+
+  /// \return The number of columns of the factors
+  Eigen::Index rank() const {
+    TA_ASSERT(pimpl_);
+    return pimpl_->u.cols();
+  }
+
+  /// Truncation tolerance accessor
+
+  /// \return The tolerance used to recompress this tile
+  scalar_type tolerance() const {
+    TA_ASSERT(pimpl_);
+    return pimpl_->tolerance;
+  }
+
+  /// Number of elements of the (uncompressed) tile
+
+  /// \return The volume of the tile range
+  size_type size() const { return (pimpl_ ? pimpl_->range.volume() : 0ul); }
+
+  /// Test if the tile is empty
+
+  /// \return \c true if this tile is not initialized
+  bool empty() const { return !pimpl_; }
+
+  /// Serialize this tile
+
+  /// \tparam Archive The archive type
+  /// \param ar The archive
+  template <typename Archive,
+            typename std::enable_if<
+                madness::is_output_archive_v<Archive>>::type* = nullptr>
+  void serialize(Archive& ar) {
+    if (pimpl_) {
+      ar & true;
+      ar & pimpl_->range & pimpl_->u & pimpl_->v & pimpl_->tolerance;
+    } else {
+      ar & false;
+    }
+  }
+
+  /// Deserialize this tile
+
+  /// \tparam Archive The archive type
+  /// \param ar The archive
+  template <typename Archive,
+            typename std::enable_if<
+                madness::is_input_archive_v<Archive>>::type* = nullptr>
+  void serialize(Archive& ar) {
+    bool have_impl = false;
+    ar & have_impl;
+    if (have_impl) {
+      auto pimpl = std::make_shared<Impl>();
+      ar & pimpl->range & pimpl->u & pimpl->v & pimpl->tolerance;
+      pimpl_ = std::move(pimpl);
+    } else {
+      pimpl_.reset();
+    }
+  }
+
+  // Permutation operations
+
+  /// Create a permuted copy of this tile
+
+  /// Transposition swaps the factors; no elements are moved.
+  /// \tparam Perm A permutation type
+  /// \param perm The permutation to be applied to this tile
+  /// \return A permuted copy of this tile
+  template <typename Perm,
+            typename = std::enable_if_t<detail::is_permutation_v<Perm>>>
+  LowRankTensor_ permute(const Perm& perm) const {
+    TA_ASSERT(pimpl_);
+    const auto& p = outer(perm);
+    TA_ASSERT(p.size() == 2u);
+    if (*p.begin() == 0u)
+      return LowRankTensor_(p * pimpl_->range, pimpl_->u, pimpl_->v,
+                            pimpl_->tolerance);
+    else
+      return LowRankTensor_(p * pimpl_->range, pimpl_->v, pimpl_->u,
+                            pimpl_->tolerance);
+  }
+
+  // Scaling operations
+
+  /// Construct a scaled copy of this tile
+
+  /// \tparam Scalar A scalar type
+  /// \param factor The scaling factor
+  /// \return A new tile where the elements of this tile are scaled by
+  /// \c factor
+  template <typename Scalar, typename std::enable_if<
+                                 detail::is_numeric_v<Scalar>>::type* = nullptr>
+  LowRankTensor_ scale(const Scalar factor) const {
+    TA_ASSERT(pimpl_);
+    return LowRankTensor_(pimpl_->range, pimpl_->u * numeric_type(factor),
+                          pimpl_->v, pimpl_->tolerance);
+  }
+
+  /// Construct a scaled and permuted copy of this tile
+
+  /// \tparam Scalar A scalar type
+  /// \tparam Perm A permutation type
+  /// \param factor The scaling factor
+  /// \param perm The permutation to be applied to this tile
+  /// \return A new tile where the elements of this tile are scaled by
+  /// \c factor and permuted
+  template <typename Scalar, typename Perm,
+            typename = std::enable_if_t<detail::is_numeric_v<Scalar> &&
+                                        detail::is_permutation_v<Perm>>>
+  LowRankTensor_ scale(const Scalar factor, const Perm& perm) const {
+    return scale(factor).permute(perm);
+  }
+
+  /// Scale this tile
+
+  /// \tparam Scalar A scalar type
+  /// \param factor The scaling factor
+  /// \return A reference to this tile
+  template <typename Scalar, typename std::enable_if<
+                                 detail::is_numeric_v<Scalar>>::type* = nullptr>
+  LowRankTensor_& scale_to(const Scalar factor) {
+    TA_ASSERT(pimpl_);
+    pimpl_->u *= numeric_type(factor);
+    return *this;
+  }
+
+  // Negation operations
+
+  /// Create a negated copy of this tile
+
+  /// \return A new tile that contains the negative values of this tile
+  LowRankTensor_ neg() const { return scale(numeric_type(-1)); }
+
+  /// Create a negated and permuted copy of this tile
+
+  /// \tparam Perm A permutation type
+  /// \param perm The permutation to be applied to this tile
+  /// \return A new tile that contains the negative values of this tile
+  template <typename Perm,
+            typename = std::enable_if_t<detail::is_permutation_v<Perm>>>
+  LowRankTensor_ neg(const Perm& perm) const {
+    return scale(numeric_type(-1), perm);
+  }
+
+  /// Negate elements of this tile
+
+  /// \return A reference to this tile
+  LowRankTensor_& neg_to() { return scale_to(numeric_type(-1)); }
+
+  // Addition operations
+
+  /// Add this and \c right to construct a new tile
+
+  /// The factors are concatenated and the result is recompressed.
+  /// \param right The tile that will be added to this tile
+  /// \return A new tile where the elements are the sum of the elements of
+  /// \c this and \c right
+  LowRankTensor_ add(const LowRankTensor_& right) const {
+    return add(right, numeric_type(1));
+  }
+
+  /// Add this and \c right to construct a new, permuted tile
+
+  /// \tparam Perm A permutation type
+  /// \param right The tile that will be added to this tile
+  /// \param perm The permutation to be applied to the result
+  /// \return A new tile where the elements are the sum of the elements of
+  /// \c this and \c right , permuted by \c perm
+  template <typename Perm,
+            typename = std::enable_if_t<detail::is_permutation_v<Perm>>>
+  LowRankTensor_ add(const LowRankTensor_& right, const Perm& perm) const {
+    return add(right).permute(perm);
+  }
+
+  /// Scale and add this and \c right to construct a new tile
+
+  /// \tparam Scalar A scalar type
+  /// \param right The tile that will be added to this tile
+  /// \param factor The scaling factor
+  /// \return A new tile where the elements are the sum of the elements of
+  /// \c this and \c right , scaled by \c factor
+  template <typename Scalar, typename std::enable_if<
+                                 detail::is_numeric_v<Scalar>>::type* = nullptr>
+  LowRankTensor_ add(const LowRankTensor_& right, const Scalar factor) const {
+    TA_ASSERT(pimpl_);
+    TA_ASSERT(!right.empty());
+    TA_ASSERT(pimpl_->range == right.range());
+    LowRankTensor_ result = clone();
+    result.add_to(right, factor);
+    return result;
+  }
+
+  /// Scale and add this and \c right to construct a new, permuted tile
+
+  /// \tparam Scalar A scalar type
+  /// \tparam Perm A permutation type
+  /// \param right The tile that will be added to this tile
+  /// \param factor The scaling factor
+  /// \param perm The permutation to be applied to the result
+  /// \return A new tile where the elements are the sum of the elements of
+  /// \c this and \c right , scaled by \c factor and permuted by \c perm
+  template <typename Scalar, typename Perm,
+            typename = std::enable_if_t<detail::is_numeric_v<Scalar> &&
+                                        detail::is_permutation_v<Perm>>>
+  LowRankTensor_ add(const LowRankTensor_& right, const Scalar factor,
+                     const Perm& perm) const {
+    return add(right, factor).permute(perm);
+  }
+
+  /// Add \c right to this tile
+
+  /// \param right The tile that will be added to this tile
+  /// \return A reference to this tile
+  LowRankTensor_& add_to(const LowRankTensor_& right) {
+    return add_to(right, numeric_type(1));
+  }
+
+  /// Add \c right to this tile, and scale the result
+
+  /// \tparam Scalar A scalar type
+  /// \param right The tile that will be added to this tile
+  /// \param factor The scaling factor
+  /// \return A reference to this tile, where
+  /// <tt>(*this) = ((*this) + right) * factor</tt>
+  template <typename Scalar, typename std::enable_if<
+                                 detail::is_numeric_v<Scalar>>::type* = nullptr>
+  LowRankTensor_& add_to(const LowRankTensor_& right, const Scalar factor) {
+    TA_ASSERT(pimpl_);
+    TA_ASSERT(!right.empty());
+    TA_ASSERT(pimpl_->range == right.range());
+    append(right.u() * numeric_type(factor), right.v(), right.tolerance());
+    if (numeric_type(factor) != numeric_type(1))
+      pimpl_->u.leftCols(pimpl_->u.cols() - right.rank()) *=
+          numeric_type(factor);
+    recompress();
+    return *this;
+  }
+
+  // Subtraction operations
+
+  /// Subtract \c right from this to construct a new tile
+
+  /// \param right The tile that will be subtracted from this tile
+  /// \return A new tile where the elements are the difference of the
+  /// elements of \c this and \c right
+  LowRankTensor_ subt(const LowRankTensor_& right) const {
+    return add(right.neg());
+  }
+
+  /// Subtract \c right from this to construct a new, permuted tile
+
+  /// \tparam Perm A permutation type
+  /// \param right The tile that will be subtracted from this tile
+  /// \param perm The permutation to be applied to the result
+  /// \return A new tile where the elements are the difference of the
+  /// elements of \c this and \c right , permuted by \c perm
+  template <typename Perm,
+            typename = std::enable_if_t<detail::is_permutation_v<Perm>>>
+  LowRankTensor_ subt(const LowRankTensor_& right, const Perm& perm) const {
+    return subt(right).permute(perm);
+  }
+
+  /// Subtract \c right from this and scale to construct a new tile
+
+  /// \tparam Scalar A scalar type
+  /// \param right The tile that will be subtracted from this tile
+  /// \param factor The scaling factor
+  /// \return A new tile where the elements are the difference of the
+  /// elements of \c this and \c right , scaled by \c factor
+  template <typename Scalar, typename std::enable_if<
+                                 detail::is_numeric_v<Scalar>>::type* = nullptr>
+  LowRankTensor_ subt(const LowRankTensor_& right, const Scalar factor) const {
+    return add(right.neg(), factor);
+  }
+
+  /// Subtract \c right from this and scale to construct a new, permuted tile
+
+  /// \tparam Scalar A scalar type
+  /// \tparam Perm A permutation type
+  /// \param right The tile that will be subtracted from this tile
+  /// \param factor The scaling factor
+  /// \param perm The permutation to be applied to the result
+  /// \return A new tile where the elements are the difference of the
+  /// elements of \c this and \c right , scaled by \c factor and permuted by
+  /// \c perm
+  template <typename Scalar, typename Perm,
+            typename = std::enable_if_t<detail::is_numeric_v<Scalar> &&
+                                        detail::is_permutation_v<Perm>>>
+  LowRankTensor_ subt(const LowRankTensor_& right, const Scalar factor,
+                      const Perm& perm) const {
+    return subt(right, factor).permute(perm);
+  }
+
+  /// Subtract \c right from this tile
+
+  /// \param right The tile that will be subtracted from this tile
+  /// \return A reference to this tile
+  LowRankTensor_& subt_to(const LowRankTensor_& right) {
+    return add_to(right.neg());
+  }
+
+  /// Subtract \c right from this tile, and scale the result
+
+  /// \tparam Scalar A scalar type
+  /// \param right The tile that will be subtracted from this tile
+  /// \param factor The scaling factor
+  /// \return A reference to this tile, where
+  /// <tt>(*this) = ((*this) - right) * factor</tt>
+  template <typename Scalar, typename std::enable_if<
+                                 detail::is_numeric_v<Scalar>>::type* = nullptr>
+  LowRankTensor_& subt_to(const LowRankTensor_& right, const Scalar factor) {
+    return add_to(right.neg(), factor);
+  }
+
+  // GEMM operations
+
+  /// Contract this tile with \c other
+
+  /// The product of two low-rank tiles has at most the smaller of the two
+  /// ranks, and is formed without expanding either operand.
+  /// \tparam Scalar A scalar type
+  /// \param other The right-hand argument
+  /// \param factor The scaling factor
+  /// \param gemm_helper The *GEMM operation meta data; only matrix-matrix
+  /// products (one contracted index) are supported
+  /// \return A new tile which is the product of this and \c other
+  template <typename Scalar, typename std::enable_if<
+                                 detail::is_numeric_v<Scalar>>::type* = nullptr>
+  LowRankTensor_ gemm(const LowRankTensor_& other, const Scalar factor,
+                      const math::GemmHelper& gemm_helper) const {
+    TA_ASSERT(pimpl_);
+    TA_ASSERT(!other.empty());
+    TA_ASSERT(gemm_helper.result_rank() == 2u);
+    TA_ASSERT(gemm_helper.left_rank() == 2u);
+    TA_ASSERT(gemm_helper.right_rank() == 2u);
+    TA_ASSERT(gemm_helper.left_right_congruent(
+        pimpl_->range.extent_data(), other.range().extent_data()));
+
+    // op(left) = l1 l2^T , op(right) = r1 r2^T
+    const matrix_type *l1, *l2, *r1, *r2;
+    matrix_type l_conj1, l_conj2, r_conj1, r_conj2;
+    op_factors(gemm_helper.left_op(), *this, l1, l2, l_conj1, l_conj2);
+    op_factors(gemm_helper.right_op(), other, r1, r2, r_conj1, r_conj2);
+
+    // l1 (l2^T r1) r2^T ; fold the core into one of the outer factors such
+    // that the product has the smaller of the two ranks
+    const matrix_type core =
+        numeric_type(factor) * (l2->transpose() * (*r1));
+    const auto result_range = gemm_helper.make_result_range<range_type>(
+        pimpl_->range, other.range());
+    const scalar_type tolerance =
+        std::max(pimpl_->tolerance, other.tolerance());
+    if (core.rows() <= core.cols())
+      return LowRankTensor_(result_range, *l1, (*r2) * core.transpose(),
+                            tolerance);
+    else
+      return LowRankTensor_(result_range, (*l1) * core, *r2, tolerance);
+  }
+
+  /// Contract two tiles and accumulate the result into this tile
+
+  /// The product is appended to the factors of this tile, which are then
+  /// recompressed. If this tile is empty, it is initialized with the
+  /// product.
+  /// \tparam Scalar A scalar type
+  /// \param left The left-hand argument
+  /// \param right The right-hand argument
+  /// \param factor The scaling factor
+  /// \param gemm_helper The *GEMM operation meta data
+  /// \return A reference to this tile
+  template <typename Scalar, typename std::enable_if<
+                                 detail::is_numeric_v<Scalar>>::type* = nullptr>
+  LowRankTensor_& gemm(const LowRankTensor_& left, const LowRankTensor_& right,
+                       const Scalar factor,
+                       const math::GemmHelper& gemm_helper) {
+    LowRankTensor_ product = left.gemm(right, factor, gemm_helper);
+    if (!pimpl_) {
+      *this = std::move(product);
+    } else {
+      TA_ASSERT(pimpl_->range == product.range());
+      append(product.u(), product.v(), product.tolerance());
+      recompress();
+    }
+    return *this;
+  }
+
+  // Reduction operations
+
+  /// Sum of all elements
+
+  /// \return The sum of all elements of this tile
+  numeric_type sum() const {
+    TA_ASSERT(pimpl_);
+    return (pimpl_->u.colwise().sum().cwiseProduct(pimpl_->v.colwise().sum()))
+        .sum();
+  }
+
+  /// Square of the Frobenius norm
+
+  /// Computed from the factors in \f$ O((m+n) r^2) \f$ operations.
+  /// \return The sum of the squared magnitudes of all elements of this tile
+  scalar_type squared_norm() const {
+    TA_ASSERT(pimpl_);
+    const matrix_type uu = pimpl_->u.transpose() * pimpl_->u.conjugate();
+    const matrix_type vv = pimpl_->v.transpose() * pimpl_->v.conjugate();
+    return std::real(uu.cwiseProduct(vv).sum());
+  }
+
+  /// Frobenius norm
+
+  /// \tparam ResultType return type
+  /// \return The Frobenius norm of this tile
+  template <typename ResultType = scalar_type>
+  ResultType norm() const {
+    return std::sqrt(static_cast<ResultType>(squared_norm()));
+  }
+
+  /// Vector dot product
+
+  /// \param other The right-hand tile to be reduced
+  /// \return The sum of the products of the elements of this and \c other
+  numeric_type dot(const LowRankTensor_& other) const {
+    TA_ASSERT(pimpl_);
+    TA_ASSERT(!other.empty());
+    TA_ASSERT(pimpl_->range == other.range());
+    const matrix_type uu = pimpl_->u.transpose() * other.u();
+    const matrix_type vv = pimpl_->v.transpose() * other.v();
+    return uu.cwiseProduct(vv).sum();
+  }
+
+ private:
+  /// Number of singular values that must be kept to satisfy a tolerance
+
+  /// \param sigma The singular values, in non-increasing order
+  /// \param tolerance The maximum Frobenius norm of the discarded part
+  /// \return The smallest rank for which the discarded singular values have
+  /// a 2-norm no greater than \c tolerance
+  template <typename Sigma>
+  static Eigen::Index truncation_rank(const Sigma& sigma,
+                                      const scalar_type tolerance) {
+    const scalar_type tolerance_sq = tolerance * tolerance;
+    scalar_type discarded_sq = 0;
+    Eigen::Index r = sigma.size();
+    for (; r > 0l; --r) {
+      discarded_sq += sigma[r - 1l] * sigma[r - 1l];
+      if (discarded_sq > tolerance_sq) break;
+    }
+    return r;
+  }
+
+  /// Factors of <tt>op(arg)</tt>
+
+  /// \param[in] op The BLAS operation applied to \c arg
+  /// \param[in] arg The tile
+  /// \param[out] f1 Points to the left-hand factor of <tt>op(arg)</tt>
+  /// \param[out] f2 Points to the right-hand factor of <tt>op(arg)</tt>
+  /// \param[out] conj1 Storage for the conjugated factor, if needed
+  /// \param[out] conj2 Storage for the conjugated factor, if needed
+  static void op_factors(const math::blas::Op op, const LowRankTensor_& arg,
+                         const matrix_type*& f1, const matrix_type*& f2,
+                         matrix_type& conj1, matrix_type& conj2) {
+    if (op == math::blas::NoTranspose) {
+      f1 = &arg.u();
+      f2 = &arg.v();
+    } else if (op == math::blas::Transpose) {
+      f1 = &arg.v();
+      f2 = &arg.u();
+    } else {
+      conj1 = arg.v().conjugate();
+      conj2 = arg.u().conjugate();
+      f1 = &conj1;
+      f2 = &conj2;
+    }
+  }
+
+  /// Append factors to this tile, increasing its rank
+
+  /// \param u The left-hand factor to append
+  /// \param v The right-hand factor to append
+  /// \param tolerance The tolerance of the appended term
+  void append(const matrix_type& u, const matrix_type& v,
+              const scalar_type tolerance) {
+    TA_ASSERT(u.rows() == pimpl_->u.rows());
+    TA_ASSERT(v.rows() == pimpl_->v.rows());
+    TA_ASSERT(u.cols() == v.cols());
+    const auto r = pimpl_->u.cols();
+    matrix_type new_u(u.rows(), r + u.cols()), new_v(v.rows(), r + v.cols());
+    new_u << pimpl_->u, u;
+    new_v << pimpl_->v, v;
+    pimpl_->u = std::move(new_u);
+    pimpl_->v = std::move(new_v);
+    pimpl_->tolerance = std::max(pimpl_->tolerance, tolerance);
+  }
+
+  /// Recompress the factors of this tile
+
+  /// With \f$ U = Q_U R_U \f$ and \f$ V = Q_V R_V \f$, the truncated SVD of the
+  /// small core \f$ R_U R_V^T = W \Sigma X^H \f$ gives
+  /// \f$ U \leftarrow Q_U W \Sigma \f$ and
+  /// \f$ V \leftarrow Q_V \bar{X} \f$ .
+  void recompress() {
+    matrix_type& u = pimpl_->u;
+    matrix_type& v = pimpl_->v;
+    if (u.cols() == 0l) return;
+
+    const auto ku = std::min(u.rows(), u.cols());
+    const auto kv = std::min(v.rows(), v.cols());
+    Eigen::HouseholderQR<matrix_type> qr_u(u), qr_v(v);
+    const matrix_type r_u =
+        qr_u.matrixQR().topRows(ku).template triangularView<Eigen::Upper>();
+    const matrix_type r_v =
+        qr_v.matrixQR().topRows(kv).template triangularView<Eigen::Upper>();
+
+    const matrix_type core = r_u * r_v.transpose();
+    Eigen::JacobiSVD<matrix_type> svd(
+        core, Eigen::ComputeThinU | Eigen::ComputeThinV);
+    const auto r = truncation_rank(svd.singularValues(), pimpl_->tolerance);
+
+    const matrix_type q_u =
+        qr_u.householderQ() * matrix_type::Identity(u.rows(), ku);
+    const matrix_type q_v =
+        qr_v.householderQ() * matrix_type::Identity(v.rows(), kv);
+    u = q_u * (svd.matrixU().leftCols(r) *
+               svd.singularValues().head(r).template cast<T>().asDiagonal());
+    v = q_v * svd.matrixV().leftCols(r).conjugate();
+  }
+
+};  // class LowRankTensor
+
+/// LowRankTensor output operator
+
+/// \tparam T The element type
+/// \param os The output stream
+/// \param t The tile to be output
+/// \return A reference to the output stream
+template <typename T>
+inline std::ostream& operator<<(std::ostream& os, const LowRankTensor<T>& t) {
+  os << t.range() << " rank=" << t.rank() << " "
+     << static_cast<Tensor<T>>(t);
+  return os;
+}
+
+}  // namespace TiledArray
+
+#endif  // TILEDARRAY_TENSOR_LOW_RANK_TENSOR_H__INCLUDED
@@ -145,15 +145,22 @@ inline void permute(InputOp&& input_op, OutputOp&& output_op, Result& result,
       output_op(result, input_op(a0, as...));
     };
 
-    // Permute the data
-    for (typename Result::ordinal_type index = 0ul; index < volume;
-         index += block_size) {
-      const typename Result::ordinal_type perm_index = perm_index_op(index);
-
-      // Copy the block
-      math::vector_ptr_op(op, block_size, result.data() + perm_index,
-                          arg0.data() + index, (args.data() + index)...);
-    }
+    // Permute the data; large tiles are split among idle threads, by blocks
+    // if there are several, otherwise within the block by vector_ptr_op
+    math::parallel_for(
+        (block_size ? volume / block_size : 0ul),
+        [&](const std::size_t first, const std::size_t last) {
+          for (typename Result::ordinal_type index = first * block_size;
+               index < last * block_size; index += block_size) {
+            const typename Result::ordinal_type perm_index =
+                perm_index_op(index);
+
+            // Copy the block
+            math::vector_ptr_op(op, block_size, result.data() + perm_index,
+                                arg0.data() + index, (args.data() + index)...);
+          }
+        },
+        block_size);
 
   } else {
     // This is the more complicated case. Here we permute in terms of matrix
@@ -184,19 +191,45 @@ inline void permute(InputOp&& input_op, OutputOp&& output_op, Result& result,
       result_outer_stride *= result_extent[i];
 
     // Copy data from the input to the output matrix via a series of matrix
-    // transposes.
-    for (typename Result::ordinal_type i = 0ul; i < other_fused_size[0]; ++i) {
-      typename Result::ordinal_type index = i * other_fused_weight[0];
-      for (typename Result::ordinal_type j = 0ul; j < other_fused_size[2];
-           ++j, index += other_fused_weight[2]) {
-        // Compute the ordinal index of the input and output matrices.
-        typename Result::ordinal_type perm_index = perm_index_op(index);
-
-        math::transpose(input_op, output_op, other_fused_size[1],
-                        other_fused_size[3], result_outer_stride,
-                        result.data() + perm_index, other_fused_weight[1],
-                        arg0.data() + index, (args.data() + index)...);
-      }
+    // transposes. Large tiles are split among idle threads, by matrices if
+    // there are several, otherwise by the rows of the argument matrix.
+    const typename Result::ordinal_type nmatrices =
+        other_fused_size[0] * other_fused_size[2];
+    const typename Result::ordinal_type matrix_volume =
+        other_fused_size[1] * other_fused_size[3];
+    auto transpose_rows = [&](const typename Result::ordinal_type index,
+                              const std::size_t first,
+                              const std::size_t last) {
+      // Compute the ordinal index of the input and output matrices.
+      const typename Result::ordinal_type perm_index = perm_index_op(index);
+      const typename Result::ordinal_type arg_offset =
+          index + first * other_fused_weight[1];
+
+      math::transpose(input_op, output_op, last - first, other_fused_size[3],
+                      result_outer_stride, result.data() + perm_index + first,
+                      other_fused_weight[1], arg0.data() + arg_offset,
+                      (args.data() + arg_offset)...);
+    };
+
+    if (nmatrices == 1ul) {
+      math::parallel_for(
+          other_fused_size[1],
+          [&](const std::size_t first, const std::size_t last) {
+            transpose_rows(0ul, first, last);
+          },
+          other_fused_size[3]);
+    } else {
+      math::parallel_for(
+          nmatrices,
+          [&](const std::size_t first, const std::size_t last) {
+            for (std::size_t ij = first; ij < last; ++ij) {
+              const typename Result::ordinal_type index =
+                  (ij / other_fused_size[2]) * other_fused_weight[0] +
+                  (ij % other_fused_size[2]) * other_fused_weight[2];
+              transpose_rows(index, 0ul, other_fused_size[1]);
+            }
+          },
+          matrix_volume);
     }
   }
 }
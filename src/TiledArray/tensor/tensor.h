@@ -26,14 +26,18 @@
 
 #include "TiledArray/math/blas.h"
 #include "TiledArray/math/gemm_helper.h"
+#include "TiledArray/math/simd.h"
 #include "TiledArray/tensor/complex.h"
 #include "TiledArray/tensor/kernels.h"
 #include "TiledArray/tile_interface/clone.h"
 #include "TiledArray/tile_interface/permute.h"
 #include "TiledArray/tile_interface/trace.h"
+#include "TiledArray/util/comm_buffer_pool.h"
 #include "TiledArray/util/logger.h"
 #include "TiledArray/util/ptr_registry.h"
 
+#include <madness/world/buffer_archive.h>
+
 namespace TiledArray {
 
 template <typename Alpha, typename... As, typename... Bs, typename Beta,
@@ -47,6 +51,14 @@ namespace detail {
 template <typename T, typename A>
 struct TraceIsDefined<Tensor<T, A>, enable_if_numeric_t<T>> : std::true_type {};
 
+/// \c true if the vectorized kernels of math/simd.h can combine the elements
+/// of the contiguous tensors \c T and \c U
+template <typename T, typename U>
+constexpr bool is_simd_tensor_pair_v =
+    is_contiguous_tensor_v<T, U> &&
+    math::simd::is_simd_type_v<typename T::value_type> &&
+    std::is_same_v<typename T::value_type, typename U::value_type>;
+
 }  // namespace detail
 
 /// An N-dimensional tensor object
@@ -976,7 +988,19 @@ class Tensor {
       ar& range;
       ar& batch_size;
       if constexpr (madness::is_input_archive_v<Archive>) {
-        *this = Tensor(std::move(range), batch_size, default_construct{true});
+        if constexpr (std::is_same_v<std::decay_t<Archive>,
+                                     madness::archive::BufferInputArchive> &&
+                      detail::is_ta_tensor_with_default_allocator_v<Tensor> &&
+                      std::is_trivially_copyable_v<value_type>) {
+          // The elements of tiles received from other nodes are stored in
+          // reusable buffers, unless the allocator places them elsewhere
+          const auto size = range.volume() * batch_size;
+          *this = Tensor(range, batch_size,
+                         detail::CommBufferPool::acquire<value_type>(
+                             detail::CommBufferPool::instance(), size));
+        } else
+          *this =
+              Tensor(std::move(range), batch_size, default_construct{true});
       }
       ar& madness::archive::wrap(this->data_.get(),
                                  this->range_.volume() * batch_size);
@@ -1441,8 +1465,14 @@ class Tensor {
   template <typename Scalar, typename std::enable_if<
                                  detail::is_numeric_v<Scalar>>::type* = nullptr>
   Tensor& scale_to(const Scalar factor) {
-    return inplace_unary(
-        [factor](numeric_type& MADNESS_RESTRICT res) { res *= factor; });
+    if constexpr (math::simd::is_simd_scalar_v<value_type, Scalar>) {
+      TA_ASSERT(!this->empty());
+      math::simd::scale(this->range().volume(), value_type(factor),
+                        this->data());
+      return *this;
+    } else
+      return inplace_unary(
+          [factor](numeric_type& MADNESS_RESTRICT res) { res *= factor; });
   }
 
   // Addition operations
@@ -1557,8 +1587,14 @@ class Tensor {
   template <typename Right,
             typename std::enable_if<is_tensor<Right>::value>::type* = nullptr>
   Tensor& add_to(const Right& right) {
-    return inplace_binary(right, [](numeric_type& MADNESS_RESTRICT l,
-                                    const numeric_t<Right> r) { l += r; });
+    if constexpr (detail::is_simd_tensor_pair_v<Tensor, Right>) {
+      TA_ASSERT(!this->empty() && !right.empty());
+      TA_ASSERT(detail::is_range_set_congruent(*this, right));
+      math::simd::add(this->range().volume(), right.data(), this->data());
+      return *this;
+    } else
+      return inplace_binary(right, [](numeric_type& MADNESS_RESTRICT l,
+                                      const numeric_t<Right> r) { l += r; });
   }
 
   /// Add \c other to this tensor, and scale the result
@@ -1695,8 +1731,14 @@ class Tensor {
   template <typename Right,
             typename std::enable_if<is_tensor<Right>::value>::type* = nullptr>
   Tensor& subt_to(const Right& right) {
-    return inplace_binary(right, [](numeric_type& MADNESS_RESTRICT l,
-                                    const numeric_t<Right> r) { l -= r; });
+    if constexpr (detail::is_simd_tensor_pair_v<Tensor, Right>) {
+      TA_ASSERT(!this->empty() && !right.empty());
+      TA_ASSERT(detail::is_range_set_congruent(*this, right));
+      math::simd::subt(this->range().volume(), right.data(), this->data());
+      return *this;
+    } else
+      return inplace_binary(right, [](numeric_type& MADNESS_RESTRICT l,
+                                      const numeric_t<Right> r) { l -= r; });
   }
 
   /// Subtract \c right from and scale this tensor
@@ -1808,8 +1850,14 @@ class Tensor {
   template <typename Right,
             typename std::enable_if<is_tensor<Right>::value>::type* = nullptr>
   Tensor& mult_to(const Right& right) {
-    return inplace_binary(right, [](numeric_type& MADNESS_RESTRICT l,
-                                    const numeric_t<Right> r) { l *= r; });
+    if constexpr (detail::is_simd_tensor_pair_v<Tensor, Right>) {
+      TA_ASSERT(!this->empty() && !right.empty());
+      TA_ASSERT(detail::is_range_set_congruent(*this, right));
+      math::simd::mult(this->range().volume(), right.data(), this->data());
+      return *this;
+    } else
+      return inplace_binary(right, [](numeric_type& MADNESS_RESTRICT l,
+                                      const numeric_t<Right> r) { l *= r; });
   }
 
   /// Scale and multiply this tensor by \c right
@@ -2236,6 +2284,10 @@ class Tensor {
 
   /// \return The vector norm of this tensor
   scalar_type squared_norm() const {
+    if constexpr (math::simd::is_simd_type_v<value_type>) {
+      TA_ASSERT(!this->empty());
+      return math::simd::squared_norm(this->range().volume(), this->data());
+    }
     auto square_op = [](scalar_type& MADNESS_RESTRICT res,
                         const numeric_type arg) {
       res += TiledArray::detail::norm(arg);
@@ -2298,6 +2350,10 @@ class Tensor {
 
   /// \return The maximum elements of this tensor
   scalar_type abs_max() const {
+    if constexpr (math::simd::is_simd_type_v<value_type>) {
+      TA_ASSERT(!this->empty());
+      return math::simd::abs_max(this->range().volume(), this->data());
+    }
     auto abs_max_op = [](scalar_type& MADNESS_RESTRICT res,
                          const numeric_type arg) {
       res = std::max(res, std::abs(arg));
@@ -2318,6 +2374,12 @@ class Tensor {
   template <typename Right,
             typename std::enable_if<is_tensor<Right>::value>::type* = nullptr>
   numeric_type dot(const Right& other) const {
+    if constexpr (detail::is_simd_tensor_pair_v<Tensor, Right>) {
+      TA_ASSERT(!this->empty() && !other.empty());
+      TA_ASSERT(detail::is_range_set_congruent(*this, other));
+      return math::simd::dot(this->range().volume(), this->data(),
+                             other.data());
+    }
     auto mult_add_op = [](numeric_type& res, const numeric_type l,
                           const numeric_t<Right> r) { res += l * r; };
     auto add_op = [](numeric_type& MADNESS_RESTRICT res,
@@ -150,6 +150,22 @@ struct is_ta_tensor<Tensor<T, A>> : public std::true_type {};
 template <typename T>
 constexpr const bool is_ta_tensor_v = is_ta_tensor<T>::value;
 
+/// Detects TiledArray::Tensor types with the default allocator
+
+/// The elements of such tensors may be stored in any host memory, e.g. in
+/// the buffers of a CommBufferPool; other allocators may place them in
+/// special memory (e.g. memory that is accessible by devices).
+template <typename T, typename Enabler = void>
+struct is_ta_tensor_with_default_allocator : public std::false_type {};
+
+template <typename T, typename A>
+struct is_ta_tensor_with_default_allocator<Tensor<T, A>>
+    : public std::is_same<Tensor<T, A>, Tensor<T>> {};
+
+template <typename T>
+constexpr const bool is_ta_tensor_with_default_allocator_v =
+    is_ta_tensor_with_default_allocator<T>::value;
+
 // Test if the tensor is contiguous
 
 template <typename T>
@@ -332,12 +332,23 @@ class ContractReduce : public ContractReduceBase<Result, Left, Right, Scalar> {
       TA_ASSERT(!this->elem_muladd_op());
       using TiledArray::empty;
       using TiledArray::gemm;
-      if (empty(result))
-        result = gemm(left, right, ContractReduceBase_::factor(),
-                      ContractReduceBase_::gemm_helper());
-      else
+      using contraction_type = std::decay_t<decltype(gemm(
+          left, right, ContractReduceBase_::factor(),
+          ContractReduceBase_::gemm_helper()))>;
+      if constexpr (!std::is_same_v<contraction_type, result_type>) {
+        // the result is wider than the operands (e.g. fp32 tiles contracted
+        // into an fp64 result): accumulate directly in the result precision
+        // instead of rounding each partial product to the operand precision
         gemm(result, left, right, ContractReduceBase_::factor(),
              ContractReduceBase_::gemm_helper());
+      } else {
+        if (empty(result))
+          result = gemm(left, right, ContractReduceBase_::factor(),
+                        ContractReduceBase_::gemm_helper());
+        else
+          gemm(result, left, right, ContractReduceBase_::factor(),
+               ContractReduceBase_::gemm_helper());
+      }
     }
   }
 
@@ -26,6 +26,7 @@
 #ifndef TILEDARRAY_TILE_OP_SCAL_H__INCLUDED
 #define TILEDARRAY_TILE_OP_SCAL_H__INCLUDED
 
+#include <TiledArray/tile_op/noop.h>
 #include <TiledArray/tile_op/tile_interface.h>
 #include <type_traits>
 #include "../tile_interface/scale.h"
@@ -130,6 +131,88 @@ class Scal {
 
 };  // class Scal
 
+/// Tile scaling operation whose factor may be applied by the consumer
+
+/// This operation is a Scal, or a Noop if the scaling factor is applied by
+/// the consumer of the tiles instead (see
+/// ScalTsrEngine::release_factor() ); in that case the argument is cloned,
+/// permuted, or passed through exactly as by Noop.
+/// \tparam Result The result type
+/// \tparam Arg The argument type
+/// \tparam Scalar The scaling factor type
+/// \tparam Consumable Flag that is \c true when Arg is consumable
+template <typename Result, typename Arg, typename Scalar, bool Consumable>
+class ReleasableScal {
+ public:
+  typedef ReleasableScal<Result, Arg, Scalar, Consumable>
+      ReleasableScal_;                                  ///< This object type
+  typedef Scal<Result, Arg, Scalar, Consumable> Scal_;  ///< The scaling op
+  typedef Noop<Result, Arg, Consumable> Noop_;  ///< The op without factor
+  typedef Arg argument_type;                    ///< The argument type
+  typedef Scalar scalar_type;                   ///< The scaling factor type
+  typedef Result result_type;                   ///< The result tile type
+
+  static constexpr bool is_consumable = Scal_::is_consumable;
+
+ private:
+  Scal_ scal_;     ///< The scaling operation
+  bool released_;  ///< If true, the factor is applied by the consumer
+
+ public:
+  // Compiler generated functions
+  ReleasableScal(const ReleasableScal_&) = default;
+  ReleasableScal(ReleasableScal_&&) = default;
+  ~ReleasableScal() = default;
+  ReleasableScal_& operator=(const ReleasableScal_&) = default;
+  ReleasableScal_& operator=(ReleasableScal_&&) = default;
+
+  /// Constructor
+
+  /// \param factor The scaling factor for the operation
+  /// \param released If \c true , \p factor is not applied and this
+  /// operation is a Noop
+  ReleasableScal(const scalar_type factor, const bool released)
+      : scal_(factor), released_(released) {
+    TA_ASSERT(!released || (std::is_same_v<result_type, argument_type>));
+  }
+
+  /// Scale and permute operator
+
+  /// \param arg The tile argument
+  /// \param perm The permutation applied to the result tile
+  /// \return A permuted and scaled copy of `arg`
+  template <typename Perm,
+            typename = std::enable_if_t<detail::is_permutation_v<Perm>>>
+  result_type operator()(const argument_type& arg, const Perm& perm) const {
+    if constexpr (std::is_same_v<result_type, argument_type>)
+      if (released_) return Noop_()(arg, perm);
+    return scal_(arg, perm);
+  }
+
+  /// Consuming scale operation
+
+  /// \tparam A The tile argument type
+  /// \param arg The tile argument
+  /// \return A scaled copy of `arg`
+  template <typename A>
+  result_type operator()(A&& arg) const {
+    if constexpr (std::is_same_v<result_type, argument_type>)
+      if (released_) return Noop_()(std::forward<A>(arg));
+    return scal_(std::forward<A>(arg));
+  }
+
+  /// Explicit consuming scale operation
+
+  /// \param arg The tile argument
+  /// \return In-place scaled `arg`
+  result_type consume(argument_type& arg) const {
+    if constexpr (std::is_same_v<result_type, argument_type>)
+      if (released_) return Noop_().consume(arg);
+    return scal_.consume(arg);
+  }
+
+};  // class ReleasableScal
+
 }  // namespace detail
 }  // namespace TiledArray
 
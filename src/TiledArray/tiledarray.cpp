@@ -1,5 +1,6 @@
 #include <TiledArray/config.h>
 #include <TiledArray/initialize.h>
+#include <TiledArray/util/comm_buffer_pool.h>
 #include <TiledArray/util/threads.h>
 
 #include <TiledArray/math/linalg/basic.h>
@@ -146,6 +147,31 @@ TiledArray::World& TiledArray::initialize(int& argc, char**& argv,
       TiledArray::set_linalg_crossover_to_distributed(
           linalg_distributed_minsize);
     }
+    const char* intra_tile_min_volume_cstr =
+        std::getenv("TA_INTRA_TILE_MIN_VOLUME");
+    if (intra_tile_min_volume_cstr) {
+      char* end;
+      const auto intra_tile_min_volume =
+          std::strtoul(intra_tile_min_volume_cstr, &end, 10);
+      if (errno == ERANGE)
+        TA_EXCEPTION(
+            "TiledArray::initialize: invalid value of environment variable "
+            "TA_INTRA_TILE_MIN_VOLUME");
+      TiledArray::intra_tile_min_volume = intra_tile_min_volume;
+    }
+    const char* comm_buffer_pool_size_cstr =
+        std::getenv("TA_COMM_BUFFER_POOL_SIZE");
+    if (comm_buffer_pool_size_cstr) {
+      char* end;
+      const auto comm_buffer_pool_size =
+          std::strtoul(comm_buffer_pool_size_cstr, &end, 10);
+      if (errno == ERANGE)
+        TA_EXCEPTION(
+            "TiledArray::initialize: invalid value of environment variable "
+            "TA_COMM_BUFFER_POOL_SIZE");
+      TiledArray::detail::CommBufferPool::instance()->set_capacity(
+          comm_buffer_pool_size);
+    }
 
     return default_world;
   } else
@@ -375,6 +375,7 @@ GENERATE_HAS_MEMBER_FUNCTION_ANYRETURN(mult)
 GENERATE_HAS_MEMBER_FUNCTION(mult)
 GENERATE_HAS_MEMBER_FUNCTION_ANYRETURN(mult_to)
 GENERATE_HAS_MEMBER_FUNCTION(mult_to)
+GENERATE_HAS_MEMBER_FUNCTION_ANYRETURN(norm)
 
 GENERATE_IS_FREE_FUNCTION_ANYRETURN(permute)
 
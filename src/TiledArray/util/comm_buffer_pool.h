@@ -0,0 +1,201 @@
+/*
+ *  This file is a part of TiledArray.
+ *  Copyright (C) 2026  Virginia Tech
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *  comm_buffer_pool.h
+ *  October 19, 2026
+ *
+ */
+
+#ifndef TILEDARRAY_UTIL_COMM_BUFFER_POOL_H__INCLUDED
+#define TILEDARRAY_UTIL_COMM_BUFFER_POOL_H__INCLUDED
+
+#include <algorithm>
+#include <cstddef>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <type_traits>
+#include <vector>
+
+namespace TiledArray {
+namespace detail {
+
+/// A pool of reusable buffers for the elements of received tiles
+
+/// The tiles received from other nodes (e.g. by DistArray::find() and by
+/// the SUMMA broadcasts) are mostly short-lived, and tiles of the same
+/// sizes are received over and over. Their elements are stored in buffers
+/// of this pool, and a buffer returns to the pool when the last tile that
+/// uses it is destroyed, so the next received tile of (about) the same size
+/// reuses it instead of allocating memory. The sizes of the buffers are
+/// rounded up to one of 4 to 8 size classes per power of 2, i.e. by less
+/// than 25%; the pool keeps at most capacity() bytes of unused buffers,
+/// the others are freed. The byte planes of compressed tiles (see WireTile)
+/// are stored in buffers of the pool too.
+///
+/// The unused buffers are memory held by each rank, i.e. by each rank of a
+/// node. Hence, unless a capacity is set, the capacity follows the largest
+/// buffer acquired so far: the pool keeps at most \c auto_buffers buffers of
+/// that size. The capacity of the pool used for received tiles can be set
+/// with the environment variable \c TA_COMM_BUFFER_POOL_SIZE (in bytes) or
+/// with set_capacity().
+class CommBufferPool {
+ public:
+  /// The alignment of the buffers, in bytes
+  static constexpr std::size_t alignment = 64ul;
+  /// Smaller buffers are not pooled, their allocation is cheap
+  static constexpr std::size_t min_size = 4096ul;
+  /// Unless a capacity is set, the number of buffers of the largest size
+  /// that the pool keeps
+  static constexpr std::size_t auto_buffers = 4ul;
+
+ private:
+  mutable std::mutex mutex_;
+  std::map<std::size_t, std::vector<void*>> free_;  ///< Unused buffers
+  std::size_t cached_ = 0ul;    ///< The size of the unused buffers
+  std::size_t capacity_ = 0ul;  ///< The largest size of the unused buffers
+  bool fixed_capacity_;         ///< If false, capacity_ is automatic
+
+  /// \param size The requested size, in bytes
+  /// \return The size of the size class of \p size
+  static std::size_t size_class(const std::size_t size) {
+    std::size_t step = alignment;
+    while (step * 8ul <= size) step *= 2ul;
+    return (size + step - 1ul) / step * step;
+  }
+
+  static void* allocate(const std::size_t size) {
+    return ::operator new(size, std::align_val_t(alignment));
+  }
+
+  static void deallocate(void* ptr) {
+    ::operator delete(ptr, std::align_val_t(alignment));
+  }
+
+  /// Return a buffer to the pool, or free it if the pool is full
+  void recycle(void* ptr, const std::size_t size) {
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      if (cached_ + size <= capacity_) {
+        free_[size].push_back(ptr);
+        cached_ += size;
+        return;
+      }
+    }
+    deallocate(ptr);
+  }
+
+ public:
+  /// Construct a pool whose capacity follows the largest buffer acquired
+  CommBufferPool() : fixed_capacity_(false) {}
+
+  /// \param capacity The largest size of the unused buffers, in bytes
+  explicit CommBufferPool(const std::size_t capacity)
+      : capacity_(capacity), fixed_capacity_(true) {}
+
+  CommBufferPool(const CommBufferPool&) = delete;
+  CommBufferPool& operator=(const CommBufferPool&) = delete;
+
+  ~CommBufferPool() { clear(); }
+
+  /// The pool used for received tiles
+
+  /// The pool is owned by the buffers too, so it outlives the tiles that
+  /// are destroyed after the end of \c main
+  /// \return A shared pointer to the pool
+  static const std::shared_ptr<CommBufferPool>& instance() {
+    static const std::shared_ptr<CommBufferPool> pool =
+        std::make_shared<CommBufferPool>();
+    return pool;
+  }
+
+  /// Get a buffer
+
+  /// \tparam T The element type, which must be trivially copyable
+  /// \param pool The pool
+  /// \param n The number of elements
+  /// \return A pointer to uninitialized storage for \p n elements, which
+  /// returns to \p pool when the last copy of the pointer is destroyed
+  template <typename T>
+  static std::shared_ptr<T> acquire(
+      const std::shared_ptr<CommBufferPool>& pool, const std::size_t n) {
+    static_assert(std::is_trivially_copyable_v<T>,
+                  "CommBufferPool only holds trivially copyable elements");
+    const std::size_t size = size_class(std::max(n * sizeof(T), alignment));
+    void* ptr = nullptr;
+    if (size >= min_size) {
+      std::lock_guard<std::mutex> lock(pool->mutex_);
+      if (!pool->fixed_capacity_)
+        pool->capacity_ = std::max(pool->capacity_, auto_buffers * size);
+      auto it = pool->free_.find(size);
+      if (it != pool->free_.end() && !it->second.empty()) {
+        ptr = it->second.back();
+        it->second.pop_back();
+        pool->cached_ -= size;
+      }
+    }
+    if (!ptr) ptr = allocate(size);
+    if (size < min_size)
+      return std::shared_ptr<T>(static_cast<T*>(ptr),
+                                [](T* p) { deallocate(p); });
+    return std::shared_ptr<T>(static_cast<T*>(ptr), [pool, size](T* p) {
+      pool->recycle(p, size);
+    });
+  }
+
+  /// \return The largest size of the unused buffers, in bytes
+  std::size_t capacity() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return capacity_;
+  }
+
+  /// \param capacity The largest size of the unused buffers, in bytes; 0
+  /// disables reuse
+  void set_capacity(const std::size_t capacity) {
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      capacity_ = capacity;
+      fixed_capacity_ = true;
+    }
+    if (cached() > capacity) clear();
+  }
+
+  /// \return The size of the unused buffers, in bytes
+  std::size_t cached() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return cached_;
+  }
+
+  /// Free the unused buffers
+  void clear() {
+    std::map<std::size_t, std::vector<void*>> free;
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      free.swap(free_);
+      cached_ = 0ul;
+    }
+    for (auto& buffers : free)
+      for (void* ptr : buffers.second) deallocate(ptr);
+  }
+
+};  // class CommBufferPool
+
+}  // namespace detail
+}  // namespace TiledArray
+
+#endif  // TILEDARRAY_UTIL_COMM_BUFFER_POOL_H__INCLUDED
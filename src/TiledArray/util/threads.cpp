@@ -1,5 +1,8 @@
 #include <TiledArray/config.h>
 #include "TiledArray/util/threads.h"
+#include "TiledArray/external/madness.h"
+
+#include <algorithm>
 
 #ifdef TILEDARRAY_HAS_INTEL_MKL
 #include <mkl_service.h>
@@ -7,6 +10,8 @@
 
 int TiledArray::max_threads = 1;
 
+std::size_t TiledArray::intra_tile_min_volume = std::size_t(1) << 18;
+
 int TiledArray::get_num_threads() {
 #ifdef TILEDARRAY_HAS_INTEL_MKL
   return mkl_get_max_threads();
@@ -19,3 +24,23 @@ void TiledArray::set_num_threads(int n) {
   mkl_set_num_threads(n);
 #endif
 }
+
+int TiledArray::intra_tile_threads(std::size_t volume) {
+  if (intra_tile_min_volume == 0ul || volume < 2ul * intra_tile_min_volume ||
+      !madness::initialized())
+    return 1;
+  // the pool threads plus the main thread, which also executes tasks
+  const std::size_t nthreads = madness::ThreadPool::size() + 1ul;
+  const std::size_t nqueued = madness::ThreadPool::queue_size();
+  if (nqueued + 1ul >= nthreads) return 1;
+  return static_cast<int>(
+      std::min(nthreads - nqueued, volume / intra_tile_min_volume));
+}
+
+int TiledArray::set_num_threads_local(int n) {
+#ifdef TILEDARRAY_HAS_INTEL_MKL
+  return mkl_set_num_threads_local(n);
+#else
+  return 0;
+#endif
+}
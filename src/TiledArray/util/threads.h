@@ -1,6 +1,8 @@
 #ifndef TILEDARRAY_UTIL_THREADS_H__INCLUDED
 #define TILEDARRAY_UTIL_THREADS_H__INCLUDED
 
+#include <cstddef>
+
 namespace TiledArray {
 
   extern int max_threads;
@@ -21,10 +23,52 @@ namespace TiledArray {
     int n_ = 0;
   };
 
+  /// Minimum number of elements per thread for a tile operation to be split
+  /// among idle threads; 0 disables intra-tile parallelism. Can be set via
+  /// the \c TA_INTRA_TILE_MIN_VOLUME environment variable.
+  extern std::size_t intra_tile_min_volume;
+
+  /// Number of threads a tile operation of \p volume elements may use
+
+  /// Tile operations run inside a single MADNESS task. When there are fewer
+  /// queued tasks than threads (e.g. when a tiling produces a few huge
+  /// tiles), a large operation may use the idle threads.
+  /// \param volume The number of elements processed by the operation
+  /// \return The number of threads to use, at least 1
+  int intra_tile_threads(std::size_t volume);
+
+  /// Sets the number of threads used by BLAS calls of the calling thread
+
+  /// \param n The number of threads; 0 reverts to the global setting
+  /// \return The previous setting of the calling thread
+  int set_num_threads_local(int n);
+
+  struct scope_num_threads_local {
+    explicit scope_num_threads_local(int n) {
+      if (n > 1) {
+        n_ = set_num_threads_local(n);
+        active_ = true;
+      }
+    }
+    ~scope_num_threads_local() {
+      if (active_) set_num_threads_local(n_);
+    }
+    scope_num_threads_local(const scope_num_threads_local&) = delete;
+  private:
+    int n_ = 0;
+    bool active_ = false;
+  };
+
 #define TA_MAX_THREADS                                  \
   TiledArray::scope_num_threads                         \
   ta_scope_num_threads(TiledArray::max_threads)
 
+/// Lets threaded BLAS calls in the current scope use the idle threads
+/// appropriate for an operation of \p volume elements
+#define TA_INTRA_TILE_THREADS(volume)                   \
+  TiledArray::scope_num_threads_local                   \
+  ta_scope_num_threads_local(TiledArray::intra_tile_threads(volume))
+
 };
 
 #endif  // TILEDARRAY_UTIL_THREADS_H__INCLUDED
@@ -0,0 +1,282 @@
+/*
+ *  This file is a part of TiledArray.
+ *  Copyright (C) 2026  Virginia Tech
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *  wire_compression.h
+ *  October 19, 2026
+ *
+ */
+
+#ifndef TILEDARRAY_UTIL_WIRE_COMPRESSION_H__INCLUDED
+#define TILEDARRAY_UTIL_WIRE_COMPRESSION_H__INCLUDED
+
+#include <TiledArray/error.h>
+#include <TiledArray/external/madness.h>
+#include <TiledArray/range.h>
+#include <TiledArray/tensor/type_traits.h>
+#include <TiledArray/util/comm_buffer_pool.h>
+
+#include <cmath>
+#include <complex>
+#include <cstring>
+#include <vector>
+
+namespace TiledArray {
+
+/// Compression of the tiles that are sent to other nodes
+
+/// The tiles of an array are compressed when they are fetched by other nodes
+/// (e.g. with DistArray::find() ) and when they are broadcast by the SUMMA
+/// contraction algorithm. Compression trades the time to encode and decode
+/// a tile for bandwidth; it pays off on bandwidth-limited networks with
+/// tiles that have many zero, or (in lossy mode) small, elements.
+///
+/// The elements of a tile are split into byte planes (i.e. byte \c b of all
+/// elements is stored contiguously, followed by byte <tt>b+1</tt>), which
+/// groups the sign and exponent bytes of the elements, and the byte planes
+/// are run-length encoded. In lossy mode the elements whose magnitude is not
+/// greater than the tolerance are set to zero before encoding. Tiles that
+/// are not TiledArray::Tensor objects with numeric elements, and tiles that
+/// do not compress, are sent as is.
+struct WireCompression {
+  enum class Mode {
+    none,      ///< Tiles are not compressed
+    lossless,  ///< Tiles are compressed without loss of precision
+    lossy      ///< Elements not greater than the tolerance are dropped
+  };
+
+  Mode mode = Mode::none;  ///< The compression mode
+  double tolerance = 0.0;  ///< The tolerance used in lossy mode
+
+  /// \return The setting that disables compression
+  static WireCompression none() { return {}; }
+
+  /// \return The lossless compression setting
+  static WireCompression lossless() { return {Mode::lossless, 0.0}; }
+
+  /// \param tolerance The largest magnitude of the dropped elements
+  /// \return The lossy compression setting
+  static WireCompression lossy(const double tolerance) {
+    TA_ASSERT(tolerance >= 0.0);
+    return {Mode::lossy, tolerance};
+  }
+
+  /// \return \c true if tiles are compressed
+  explicit operator bool() const { return mode != Mode::none; }
+
+  /// MADNESS serialization function
+
+  /// \tparam Archive A MADNESS archive type
+  /// \param[out] ar An input/output archive
+  template <typename Archive>
+  void serialize(Archive& ar) {
+    ar& mode& tolerance;
+  }
+};  // struct WireCompression
+
+namespace detail {
+
+/// Run-length encode a byte sequence
+
+/// The encoding is a sequence of packets with a header byte \c h : if
+/// <tt>h < 128</tt>, \c h+1 literal bytes follow the header; otherwise the
+/// byte that follows the header is repeated <tt>h - 125</tt> times.
+/// \param[in] first A pointer to the first byte
+/// \param[in] n The number of bytes
+/// \param[out] result The encoded bytes are appended to \c result
+inline void rle_encode(const unsigned char* first, const std::size_t n,
+                       std::vector<unsigned char>& result) {
+  std::size_t i = 0ul;
+  while (i < n) {
+    // Measure the run that starts at i
+    std::size_t run = 1ul;
+    while (i + run < n && run < 130ul && first[i + run] == first[i]) ++run;
+
+    if (run >= 3ul) {
+      result.push_back(static_cast<unsigned char>(run + 125ul));
+      result.push_back(first[i]);
+      i += run;
+    } else {
+      // Collect literals until the next run of 3 or more bytes
+      std::size_t last = i;
+      while (last < n && last - i < 128ul &&
+             !(last + 2ul < n && first[last] == first[last + 1ul] &&
+               first[last] == first[last + 2ul]))
+        ++last;
+      result.push_back(static_cast<unsigned char>(last - i - 1ul));
+      result.insert(result.end(), first + i, first + last);
+      i = last;
+    }
+  }
+}
+
+/// Decode a run-length encoded byte sequence
+
+/// \param[in] first A pointer to the first encoded byte
+/// \param[in] n The number of encoded bytes
+/// \param[out] result A pointer to the decoded bytes
+/// \param[in] size The number of decoded bytes
+/// \throw TiledArray::Exception if the encoding is corrupt
+inline void rle_decode(const unsigned char* first, const std::size_t n,
+                       unsigned char* result, const std::size_t size) {
+  std::size_t i = 0ul, j = 0ul;
+  while (i < n) {
+    const std::size_t header = first[i++];
+    if (header < 128ul) {
+      const std::size_t count = header + 1ul;
+      TA_ASSERT(i + count <= n && j + count <= size);
+      std::memcpy(result + j, first + i, count);
+      i += count;
+      j += count;
+    } else {
+      const std::size_t count = header - 125ul;
+      TA_ASSERT(i < n && j + count <= size);
+      std::memset(result + j, first[i++], count);
+      j += count;
+    }
+  }
+  if (j != size) TA_EXCEPTION("Corrupt run-length encoded tile");
+}
+
+/// A tile in its wire format
+
+/// Holds either the tile, or its compressed elements (see WireCompression
+/// ). The owner of a tile constructs a WireTile and sends it; the receivers
+/// call tile() to decode the tile.
+/// \tparam T The tile type
+template <typename T>
+class WireTile {
+ public:
+  /// \c true if the elements of \c T can be compressed
+  static constexpr bool compressible = [] {
+    if constexpr (is_ta_tensor_v<T>)
+      return is_numeric_v<typename T::value_type>;
+    else
+      return false;
+  }();
+
+ private:
+  T tile_;                            ///< The tile, if not compressed
+  bool compressed_ = false;           ///< \c true if \c bytes_ holds the tile
+  Range range_;                       ///< The range of the compressed tile
+  std::vector<unsigned char> bytes_;  ///< The encoded elements
+
+ public:
+  WireTile() = default;
+
+  /// Encode a tile
+
+  /// \param tile The tile to be encoded
+  /// \param compression The compression setting
+  WireTile(const T& tile, const WireCompression& compression) {
+    if constexpr (compressible) {
+      if (compression && !tile.empty() && tile.batch_size() == 1ul) {
+        typedef typename T::value_type value_type;
+        constexpr std::size_t width = sizeof(value_type);
+        const std::size_t size = tile.range().volume();
+
+        // Split the elements into byte planes, dropping small elements; the
+        // planes are stored in a buffer of the pool of received tiles, which
+        // bounds the memory of the unused buffers
+        const auto* MADNESS_RESTRICT data = tile.data();
+        const std::size_t nbytes = size * width;
+        const auto buffer = CommBufferPool::acquire<unsigned char>(
+            CommBufferPool::instance(), nbytes);
+        auto* MADNESS_RESTRICT planes = buffer.get();
+        const value_type zero{};
+        for (std::size_t i = 0ul; i < size; ++i) {
+          const value_type& value =
+              (compression.mode == WireCompression::Mode::lossy &&
+               std::abs(data[i]) <= compression.tolerance)
+                  ? zero
+                  : data[i];
+          const auto* MADNESS_RESTRICT bytes =
+              reinterpret_cast<const unsigned char*>(&value);
+          for (std::size_t b = 0ul; b < width; ++b)
+            planes[b * size + i] = bytes[b];
+        }
+
+        // Keep the encoding only if it is smaller than the tile
+        rle_encode(planes, nbytes, bytes_);
+        if (bytes_.size() < nbytes) {
+          compressed_ = true;
+          range_ = tile.range();
+          return;
+        }
+        bytes_ = std::vector<unsigned char>();
+      }
+    }
+    tile_ = tile;
+  }
+
+  /// \return \c true if the tile is compressed
+  bool compressed() const { return compressed_; }
+
+  /// \return The number of bytes of the encoded elements
+  std::size_t encoded_size() const { return bytes_.size(); }
+
+  /// Decode the tile
+
+  /// \return The tile
+  T tile() const {
+    if constexpr (compressible) {
+      if (compressed_) {
+        typedef typename T::value_type value_type;
+        constexpr std::size_t width = sizeof(value_type);
+        const std::size_t size = range_.volume();
+        const auto buffer = CommBufferPool::acquire<unsigned char>(
+            CommBufferPool::instance(), size * width);
+        const auto* MADNESS_RESTRICT planes = buffer.get();
+        rle_decode(bytes_.data(), bytes_.size(), buffer.get(), size * width);
+
+        // The elements are stored in a reusable buffer too, unless the
+        // allocator of T places them elsewhere
+        T result;
+        if constexpr (is_ta_tensor_with_default_allocator_v<T>)
+          result = T(range_, 1ul,
+                     CommBufferPool::acquire<value_type>(
+                         CommBufferPool::instance(), size));
+        else
+          result = T(range_);
+        auto* MADNESS_RESTRICT bytes =
+            reinterpret_cast<unsigned char*>(result.data());
+        for (std::size_t i = 0ul; i < size; ++i)
+          for (std::size_t b = 0ul; b < width; ++b)
+            bytes[i * width + b] = planes[b * size + i];
+        return result;
+      }
+    }
+    return tile_;
+  }
+
+  /// MADNESS serialization function
+
+  /// \tparam Archive A MADNESS archive type
+  /// \param[out] ar An input/output archive
+  template <typename Archive>
+  void serialize(Archive& ar) {
+    ar& compressed_;
+    if (compressed_)
+      ar& range_& bytes_;
+    else
+      ar& tile_;
+  }
+};  // class WireTile
+
+}  // namespace detail
+}  // namespace TiledArray
+
+#endif  // TILEDARRAY_UTIL_WIRE_COMPRESSION_H__INCLUDED
@@ -41,6 +41,7 @@
 #include <TiledArray/conversions/sparse_to_dense.h>
 #include <TiledArray/conversions/to_new_tile_type.h>
 #include <TiledArray/conversions/truncate.h>
+#include <TiledArray/expressions/expr_batch.h>
 #include <TiledArray/expressions/scal_expr.h>
 #include <TiledArray/expressions/tsr_expr.h>
 
@@ -49,7 +50,9 @@
 
 // Process maps
 #include <TiledArray/pmap/hash_pmap.h>
+#include <TiledArray/pmap/morton_pmap.h>
 #include <TiledArray/pmap/replicated_pmap.h>
+#include <TiledArray/pmap/weighted_blocked_pmap.h>
 
 // Utility functionality
 #include <TiledArray/conversions/eigen.h>
@@ -542,4 +542,70 @@ BOOST_AUTO_TEST_CASE(concat) {
   do_test(static_cast<TSpArrayI*>(nullptr));
 }
 
+BOOST_AUTO_TEST_CASE(concat_shared_tiles) {
+  // copies of TA::Tile share their tensor, including its range, so concat
+  // must not shift the tiles of its arguments in place
+  using TileI = TiledArray::Tile<TensorI>;
+  using TArrayTI = DistArray<TileI, DensePolicy>;
+  TArrayTI a(*GlobalFixture::world, tr), b(*GlobalFixture::world, tr);
+  for (auto* array : {&a, &b})
+    for (auto&& ord : *array->pmap())
+      array->set(ord, TileI(make_rand_tile<TensorI>(
+                          array->trange().make_tile_range(ord))));
+
+  const std::vector<bool> is_concatted(tr.rank(), true);
+  auto ab = TiledArray::concat<TileI, DensePolicy>({a, b}, is_concatted);
+
+  const auto& a_tiles = a.trange().tiles_range();
+  for (auto&& ord : *b.pmap()) {
+    const auto b_tile = b.find_local(ord).get();
+    BOOST_CHECK_EQUAL(b_tile.range(), b.trange().make_tile_range(ord));
+
+    auto idx = b.trange().tiles_range().idx(ord);
+    for (auto mode = 0ul; mode != idx.size(); ++mode)
+      idx[mode] += a_tiles.extent(mode);
+    const auto ab_tile = ab.find(idx).get();
+    BOOST_CHECK_EQUAL(ab_tile.range(), ab.trange().make_tile_range(idx));
+    BOOST_CHECK_EQUAL_COLLECTIONS(b_tile.tensor().begin(),
+                                  b_tile.tensor().end(),
+                                  ab_tile.tensor().begin(),
+                                  ab_tile.tensor().end());
+  }
+}
+
+BOOST_AUTO_TEST_CASE(array_batch) {
+  std::vector<TSpArrayD> arrays;
+  for (auto v = 0; v != 3; ++v) {
+    TSpArrayD array(*GlobalFixture::world, tr, shape_tr);
+    random_fill(array);
+    arrays.push_back(array);
+  }
+  ArrayBatch<TSpArrayD> batch(arrays);
+  BOOST_CHECK_EQUAL(batch.size(), 3ul);
+
+  // the tiles of the fused view share the data of the tiles of the members
+  const auto& fused = batch.fused();
+  BOOST_CHECK_EQUAL(fused.trange().rank(), tr.rank() + 1);
+  const auto ntiles = tr.tiles_range().volume();
+  for (auto&& ord : *fused.pmap()) {
+    const auto& array = arrays[ord / ntiles];
+    BOOST_CHECK_EQUAL(fused.is_zero(ord), array.is_zero(ord % ntiles));
+    if (fused.is_zero(ord)) continue;
+    BOOST_CHECK_EQUAL(fused.find_local(ord).get().data(),
+                      array.find_local(ord % ntiles).get().data());
+  }
+
+  // batched expression over the fused view, split into a batch
+  const auto annot = detail::dummy_annotation(tr.rank());
+  TSpArrayD r;
+  BOOST_REQUIRE_NO_THROW(r("k," + annot) = 2 * batch("k," + annot));
+  ArrayBatch<TSpArrayD> rs(r);
+  BOOST_REQUIRE_EQUAL(rs.size(), 3ul);
+  for (auto v = 0; v != 3; ++v) {
+    TSpArrayD ref;
+    ref(annot) = 2 * arrays[v](annot);
+    BOOST_CHECK_SMALL((rs[v](annot) - ref(annot)).norm().get(), 1e-10);
+  }
+}
+
 BOOST_AUTO_TEST_SUITE_END()
@@ -60,4 +60,31 @@ BOOST_AUTO_TEST_CASE(make_diagonal_array) {
   GlobalFixture::world->gop.fence();
 };
 
+BOOST_AUTO_TEST_CASE(diagonal_scale) {
+  const auto M = 48, N = 32;
+
+  auto trange0 = gen_trange1(M, {7ul, 13ul, 3ul, 11ul});
+  auto trange1 = gen_trange1(N, {3ul, 11ul, 7ul, 13ul});
+  auto trange = TA::TiledRange({trange0, trange1});
+
+  std::vector<double> v(N);
+  for (auto n = 0; n != N; ++n) v[n] = 0.5 + n;
+
+  TA::TSpArray<double> a(*GlobalFixture::world, trange);
+  a.fill_random();
+
+  // a * diag(v) is a scaled copy of a
+  auto d = TA::diagonal_array<TA::TSpArray<double> >(
+      *GlobalFixture::world, TA::TiledRange({trange1, trange1}), v.begin(),
+      v.end());
+  TA::TSpArray<double> ref;
+  ref("i,j") = a("i,k") * d("k,j");
+  TA::TSpArray<double> result;
+  BOOST_REQUIRE_NO_THROW(result = TA::diagonal_scale(a, 1, v.begin()));
+  BOOST_CHECK_EQUAL(result.trange(), trange);
+  BOOST_CHECK_SMALL((result("i,j") - ref("i,j")).norm().get(), 1e-10);
+
+  GlobalFixture::world->gop.fence();
+};
+
 BOOST_AUTO_TEST_SUITE_END()
@@ -505,6 +505,28 @@ BOOST_AUTO_TEST_CASE(truncate) {
   BOOST_CHECK(std::distance(b_trunc1.begin(), b_trunc1.end()) == 0);
 }
 
+BOOST_AUTO_TEST_CASE(truncate_inplace) {
+  auto b_trunc0 = b.clone();
+  world.gop.fence();
+  const auto b_untrunc0 = b_trunc0;  // shallow copy
+  const auto nnz = b_trunc0.shape().nnz();
+  BOOST_CHECK_NO_THROW(b_trunc0.truncate_inplace());
+  BOOST_CHECK_EQUAL(b_trunc0.shape().nnz(), nnz);
+
+  // surviving tiles are shared, not copied
+  for (auto it = b_trunc0.begin(); it != b_trunc0.end(); ++it) {
+    const auto ord = it.ordinal();
+    BOOST_CHECK_EQUAL(it->get().data(),
+                      b_untrunc0.find_local(ord).get().data());
+  }
+
+  auto b_trunc1 = b.clone();
+  BOOST_CHECK_NO_THROW(b_trunc1.truncate_inplace(
+      std::numeric_limits<
+          typename decltype(b)::shape_type::value_type>::max()));
+  BOOST_CHECK(std::distance(b_trunc1.begin(), b_trunc1.end()) == 0);
+}
+
 BOOST_AUTO_TEST_CASE(make_replicated) {
   // Get a copy of the original process map
   std::shared_ptr<const ArrayN::pmap_interface> distributed_pmap = a.pmap();
@@ -535,6 +557,69 @@ BOOST_AUTO_TEST_CASE(make_replicated) {
 
 }
 
+BOOST_AUTO_TEST_CASE(make_node_replicated) {
+  // Get a copy of the original process map
+  std::shared_ptr<const SpArrayN::pmap_interface> distributed_pmap = b.pmap();
+  SpArrayN c = b;
+
+  // Convert array to an array that is replicated once per node
+  BOOST_REQUIRE_NO_THROW(c.make_node_replicated());
+
+  if (GlobalFixture::world->size() == 1)
+    BOOST_CHECK(!c.pmap()->is_replicated());
+  else
+    BOOST_CHECK(c.pmap()->is_replicated());
+
+  // Check that all the data is local and unchanged
+  for (std::size_t i = 0; i < c.size(); ++i) {
+    BOOST_CHECK(c.is_local(i));
+    BOOST_CHECK_EQUAL(c.is_zero(i), b.is_zero(i));
+    if (c.is_zero(i)) continue;
+    const auto tile = c.find(i).get();
+    BOOST_CHECK_EQUAL(tile.range(), c.trange().make_tile_range(i));
+    for (auto it = tile.begin(); it != tile.end(); ++it)
+      BOOST_CHECK_EQUAL(*it, distributed_pmap->owner(i) + 1);
+  }
+}
+
+BOOST_AUTO_TEST_CASE(rebalance) {
+  // Get a copy of the original process map
+  std::shared_ptr<const SpArrayN::pmap_interface> old_pmap = b.pmap();
+
+  // Weigh tiles by their ordinal
+  std::vector<double> costs(b.size());
+  for (std::size_t i = 0; i < b.size(); ++i) costs[i] = i + 1;
+  auto pmap = std::make_shared<detail::WeightedBlockedPmap>(world, costs);
+
+  BOOST_REQUIRE_NO_THROW(b.rebalance(pmap));
+  world.gop.fence();
+  BOOST_CHECK_EQUAL(b.pmap(), pmap);
+
+  // Check that the local tiles are in place and hold the original data
+  for (std::size_t i = 0; i < b.size(); ++i) {
+    BOOST_CHECK_EQUAL(b.owner(i), pmap->owner(i));
+    if (b.is_zero(i) || !b.is_local(i)) continue;
+    const auto tile = b.find_local(i).get();
+    BOOST_CHECK_EQUAL(tile.range(), b.trange().make_tile_range(i));
+    for (auto it = tile.begin(); it != tile.end(); ++it)
+      BOOST_CHECK_EQUAL(*it, old_pmap->owner(i) + 1);
+  }
+
+  // A replicated process map is kept too
+  auto replicated_pmap =
+      std::make_shared<detail::ReplicatedPmap>(world, b.size());
+  BOOST_REQUIRE_NO_THROW(b.rebalance(replicated_pmap));
+  world.gop.fence();
+  BOOST_CHECK_EQUAL(b.pmap(), replicated_pmap);
+  for (std::size_t i = 0; i < b.size(); ++i) {
+    if (b.is_zero(i)) continue;
+    BOOST_CHECK(b.is_local(i));
+    const auto tile = b.find_local(i).get();
+    for (auto it = tile.begin(); it != tile.end(); ++it)
+      BOOST_CHECK_EQUAL(*it, old_pmap->owner(i) + 1);
+  }
+}
+
 BOOST_AUTO_TEST_CASE(serialization_by_tile) {
   decltype(a) acopy(a.world(), a.trange(), a.shape());
 
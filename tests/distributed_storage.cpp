@@ -101,4 +101,83 @@ BOOST_AUTO_TEST_CASE(array_operator) {
   BOOST_CHECK_THROW(t.get(t.max_size() + 2), TiledArray::Exception);
 }
 
+BOOST_AUTO_TEST_CASE(wire_tile) {
+  // tiles with many zeros are compressed without loss
+  TensorD tile(Range{7, 11, 13}, 0.0);
+  for (std::size_t i = 0ul; i < tile.size(); i += 17) tile[i] = 1.0 / (i + 1);
+  detail::WireTile<TensorD> lossless(tile, WireCompression::lossless());
+  BOOST_CHECK(lossless.compressed());
+  BOOST_CHECK_LT(lossless.encoded_size(), tile.size() * sizeof(double));
+  BOOST_CHECK_EQUAL(lossless.tile(), tile);
+
+  // small elements are dropped in lossy mode
+  for (std::size_t i = 1ul; i < tile.size(); i += 17) tile[i] = 1.0e-12;
+  detail::WireTile<TensorD> lossy(tile, WireCompression::lossy(1.0e-10));
+  BOOST_CHECK(lossy.compressed());
+  const TensorD decoded = lossy.tile();
+  for (std::size_t i = 0ul; i < tile.size(); ++i)
+    BOOST_CHECK_EQUAL(decoded[i], (i % 17ul == 1ul ? 0.0 : tile[i]));
+
+  // other tiles, and tiles that do not compress, are sent as is
+  detail::WireTile<int> other(1, WireCompression::lossless());
+  BOOST_CHECK(!other.compressed());
+  BOOST_CHECK_EQUAL(other.tile(), 1);
+  TensorD dense(Range{3, 5});
+  for (std::size_t i = 0ul; i < dense.size(); ++i) dense[i] = std::sin(i + 0.5);
+  detail::WireTile<TensorD> incompressible(dense, WireCompression::lossless());
+  BOOST_CHECK_EQUAL(incompressible.tile(), dense);
+  detail::WireTile<TensorD> none(tile, WireCompression::none());
+  BOOST_CHECK(!none.compressed());
+}
+
+BOOST_AUTO_TEST_CASE(comm_buffer_pool) {
+  TensorD tile(Range{61, 67});
+  for (std::size_t i = 0ul; i < tile.size(); ++i) tile[i] = i;
+  std::vector<unsigned char> buf(tile.size() * sizeof(double) + 1024ul);
+  madness::archive::BufferOutputArchive oar(buf.data(), buf.size());
+  oar& tile;
+  const std::size_t nbyte = oar.size();
+  oar.close();
+
+  auto receive = [&]() {
+    TensorD result;
+    madness::archive::BufferInputArchive iar(buf.data(), nbyte);
+    iar& result;
+    iar.close();
+    return result;
+  };
+
+  // the buffer of a received tile is reused once the tile is destroyed
+  const double* data = nullptr;
+  {
+    const TensorD received = receive();
+    BOOST_CHECK_EQUAL(received, tile);
+    data = received.data();
+  }
+  const TensorD received = receive();
+  BOOST_CHECK_EQUAL(received, tile);
+  BOOST_CHECK_EQUAL(received.data(), data);
+}
+
+BOOST_AUTO_TEST_CASE(wire_compression) {
+  detail::DistributedStorage<TensorD> s(world, 10, pmap);
+  s.set_wire_compression(WireCompression::lossless());
+  BOOST_CHECK(s.wire_compression().mode == WireCompression::Mode::lossless);
+
+  for (std::size_t i = 0; i < s.max_size(); ++i) {
+    if (!s.is_local(i)) continue;
+    TensorD tile(Range{32, 32}, 0.0);
+    tile[i] = double(i);
+    s.set(i, tile);
+  }
+
+  // remote elements are compressed by their owner
+  for (std::size_t i = 0; i < s.max_size(); ++i) {
+    const TensorD tile = s.get(i).get();
+    BOOST_CHECK_EQUAL(tile[i], double(i));
+    BOOST_CHECK_EQUAL(tile.sum(), double(i));
+  }
+  world.gop.fence();
+}
+
 BOOST_AUTO_TEST_SUITE_END()
@@ -372,6 +372,73 @@ BOOST_AUTO_TEST_CASE(array_to_vector) {
   }
 }
 
+BOOST_AUTO_TEST_CASE(matrix_rows_to_array) {
+  // Fill the matrix with random data and replicate across the world
+  matrix = decltype(matrix)::Random(matrix.rows(), matrix.cols());
+  GlobalFixture::world->gop.broadcast_serializable(matrix, 0);
+
+  // Each rank holds a block of rows; the last one holds the remainder
+  const std::size_t nproc = GlobalFixture::world->size();
+  const std::size_t me = GlobalFixture::world->rank();
+  const std::size_t block = matrix.rows() / nproc;
+  const std::size_t offset = me * block;
+  const std::size_t nrows = (me + 1 == nproc ? matrix.rows() - offset : block);
+  EigenMatrixXi rows = matrix.middleRows(offset, nrows);
+
+  // Copy the row-major blocks to array
+  BOOST_CHECK_NO_THROW((array = eigen_rows_to_array<TArrayI>(
+                            *GlobalFixture::world, trange, rows, offset)));
+
+  // Check that the data in array is equal to that in matrix
+  for (Range::const_iterator it = array.tiles_range().begin();
+       it != array.tiles_range().end(); ++it) {
+    Future<TArrayI::value_type> tile = array.find(*it);
+    for (Range::const_iterator tile_it = tile.get().range().begin();
+         tile_it != tile.get().range().end(); ++tile_it) {
+      BOOST_CHECK_EQUAL(tile.get()[*tile_it],
+                        matrix((*tile_it)[0], (*tile_it)[1]));
+    }
+  }
+
+  // Copy a block of rows that straddles tile boundaries back, in both storage
+  // orders
+  const std::size_t back_offset = (offset + 1) % matrix.rows();
+  const std::size_t back_nrows =
+      std::min<std::size_t>(nrows + 3, matrix.rows() - back_offset);
+  Eigen::MatrixXi back;
+  EigenMatrixXi rback;
+  BOOST_CHECK_NO_THROW(back = array_to_eigen_rows(array, back_offset,
+                                                  back_nrows));
+  BOOST_CHECK_NO_THROW(
+      (rback = array_to_eigen_rows<Tensor<int>, DensePolicy, Eigen::RowMajor>(
+           array, back_offset, back_nrows)));
+  BOOST_CHECK(back == matrix.middleRows(back_offset, back_nrows));
+  BOOST_CHECK(rback == matrix.middleRows(back_offset, back_nrows));
+
+  GlobalFixture::world->gop.fence();
+}
+
+BOOST_AUTO_TEST_CASE(vector_rows_to_array) {
+  // Fill the vector with random data and replicate across the world
+  vector = Eigen::VectorXi::Random(vector.size());
+  GlobalFixture::world->gop.broadcast_serializable(vector, 0);
+
+  // Rank 0 holds all elements; the other blocks are empty
+  const bool first = (GlobalFixture::world->rank() == 0);
+  Eigen::VectorXi rows = (first ? vector : Eigen::VectorXi());
+
+  // Convert the vector to an array
+  BOOST_CHECK_NO_THROW((array1 = eigen_rows_to_array<TArrayI>(
+                            *GlobalFixture::world, trange1, rows, 0)));
+
+  // Check that the data in array matches the data in vector
+  Eigen::MatrixXi back;
+  BOOST_CHECK_NO_THROW(back = array_to_eigen_rows(array1, 0, vector.size()));
+  BOOST_CHECK(back.col(0) == vector);
+
+  GlobalFixture::world->gop.fence();
+}
+
 BOOST_AUTO_TEST_CASE(subtensor_to_tensor) {
   // Fill the tensor with random data
   tensor.setRandom();
@@ -274,6 +274,22 @@ BOOST_FIXTURE_TEST_CASE_TEMPLATE(scale_permute, F, Fixtures, F) {
   }
 }
 
+BOOST_FIXTURE_TEST_CASE_TEMPLATE(scale_unit_factor, F, Fixtures, F) {
+  auto& a = F::a;
+  auto& c = F::c;
+  BOOST_REQUIRE_NO_THROW(c("a,b,c") = 1 * a("a,b,c"));
+
+  for (auto it = c.begin(); it != c.end(); ++it) {
+    const typename F::TArray::value_type tile = *it;
+    const auto a_tile = a.find(it.ordinal()).get();
+
+    // Check that the result tiles do not share the data of the argument tiles
+    BOOST_CHECK_NE(tile.data(), a_tile.data());
+    for (std::size_t i = 0ul; i < tile.size(); ++i)
+      BOOST_CHECK_EQUAL(tile[i], a_tile[i]);
+  }
+}
+
 BOOST_FIXTURE_TEST_CASE_TEMPLATE(block, F, Fixtures, F) {
   auto& a = F::a;
   auto& b = F::b;
@@ -2488,6 +2504,216 @@ BOOST_FIXTURE_TEST_CASE_TEMPLATE(scale_cont_permute_permute, F, Fixtures, F) {
   }
 }
 
+BOOST_FIXTURE_TEST_CASE_TEMPLATE(scaled_args_cont, F, Fixtures, F) {
+  auto& a = F::a;
+  auto& b = F::b;
+  auto& w = F::w;
+
+  typename F::TArray a_copy = TiledArray::clone(a);
+  typename F::TArray reference;
+  reference("i,j") = 6 * (a("i,b,c") * b("j,b,c"));
+
+  // the argument factors are applied by GEMM instead of to copies of the tiles
+  BOOST_REQUIRE_NO_THROW(w("i,j") = (2 * a("i,b,c")) * (3 * b("j,b,c")));
+
+  for (auto it = w.begin(); it != w.end(); ++it) {
+    const typename F::TArray::value_type tile = *it;
+    const auto ref_tile = reference.find(it.ordinal()).get();
+    for (std::size_t i = 0ul; i < tile.size(); ++i)
+      BOOST_CHECK_EQUAL(tile[i], ref_tile[i]);
+  }
+
+  // the arguments are left intact
+  for (auto it = a.begin(); it != a.end(); ++it) {
+    const typename F::TArray::value_type tile = *it;
+    const auto copy_tile = a_copy.find(it.ordinal()).get();
+    for (std::size_t i = 0ul; i < tile.size(); ++i)
+      BOOST_CHECK_EQUAL(tile[i], copy_tile[i]);
+  }
+}
+
+BOOST_FIXTURE_TEST_CASE_TEMPLATE(truncated_result, F, Fixtures, F) {
+  auto& a = F::a;
+  auto& b = F::b;
+  auto& w = F::w;
+
+  auto check = [](const typename F::TArray& result,
+                  typename F::TArray& reference) {
+    reference.truncate();
+    for (std::size_t ord = 0ul; ord < reference.size(); ++ord) {
+      BOOST_CHECK_EQUAL(result.is_zero(ord), reference.is_zero(ord));
+      if (result.is_zero(ord) || !result.is_local(ord)) continue;
+      const auto tile = result.find(ord).get();
+      const auto ref_tile = reference.find(ord).get();
+      for (std::size_t i = 0ul; i < tile.size(); ++i)
+        BOOST_CHECK_EQUAL(tile[i], ref_tile[i]);
+    }
+  };
+
+  typename F::TArray reference;
+  reference("a,b,c") = a("a,b,c") + b("a,b,c");
+  BOOST_REQUIRE_NO_THROW(w("a,b,c") =
+                             (a("a,b,c") + b("a,b,c")).set_truncate());
+  check(w, reference);
+
+  // all tiles of the result are zero
+  reference("a,b,c") = a("a,b,c") - a("a,b,c");
+  BOOST_REQUIRE_NO_THROW(w("a,b,c") =
+                             (a("a,b,c") - a("a,b,c")).set_truncate());
+  check(w, reference);
+
+  reference("i,j") = a("i,b,c") * b("j,b,c");
+  BOOST_REQUIRE_NO_THROW(w("i,j") = (a("i,b,c") * b("j,b,c")).set_truncate());
+  check(w, reference);
+
+  // the result only copies argument tiles
+  reference("c,b,a") = 2 * a("a,b,c");
+  BOOST_REQUIRE_NO_THROW(w("c,b,a") = (2 * a("a,b,c")).set_truncate());
+  check(w, reference);
+}
+
+BOOST_FIXTURE_TEST_CASE_TEMPLATE(async_assignment, F, Fixtures, F) {
+  auto& a = F::a;
+  auto& b = F::b;
+
+  auto check = [](const typename F::TArray& result,
+                  const typename F::TArray& reference) {
+    for (std::size_t ord = 0ul; ord < reference.size(); ++ord) {
+      BOOST_CHECK_EQUAL(result.is_zero(ord), reference.is_zero(ord));
+      if (result.is_zero(ord) || !result.is_local(ord)) continue;
+      const auto tile = result.find(ord).get();
+      const auto ref_tile = reference.find(ord).get();
+      for (std::size_t i = 0ul; i < tile.size(); ++i)
+        BOOST_CHECK_EQUAL(tile[i], ref_tile[i]);
+    }
+  };
+
+  // independent expressions, and an expression that uses the result of
+  // another one before it is done
+  typename F::TArray u, v, x;
+  auto u_done = u("a,b,c").assign_async(a("a,b,c") + b("a,b,c"));
+  auto v_done = v("i,j").assign_async(a("i,b,c") * b("j,b,c"));
+  auto x_done = x("j,i").assign_async(2 * v("i,j"));
+  BOOST_REQUIRE_NO_THROW(u_done.get());
+  BOOST_REQUIRE_NO_THROW(x_done.get());
+  BOOST_REQUIRE_NO_THROW(v_done.get());
+
+  typename F::TArray reference;
+  reference("a,b,c") = a("a,b,c") + b("a,b,c");
+  check(u, reference);
+  reference("i,j") = a("i,b,c") * b("j,b,c");
+  check(v, reference);
+  check(v_done.get(), reference);
+  typename F::TArray x_reference;
+  x_reference("j,i") = 2 * reference("i,j");
+  check(x, x_reference);
+}
+
+BOOST_FIXTURE_TEST_CASE_TEMPLATE(expr_batch, F, Fixtures, F) {
+  auto& a = F::a;
+  auto& b = F::b;
+
+  std::vector<typename F::TArray> results(3);
+  {
+    expressions::ExprBatch batch;
+    batch.add(results[0]("i,j"), a("i,b,c") * b("j,b,c"))
+        .add(results[1]("a,b,c"), a("a,b,c") - b("a,b,c"))
+        .add(results[2]("j,i"), 2 * results[0]("i,j"));
+    BOOST_CHECK_EQUAL(batch.size(), 3ul);
+    BOOST_REQUIRE_NO_THROW(batch.wait());
+    BOOST_CHECK(batch.empty());
+
+    // the destructor waits for assignments that were not waited for
+    batch.add(results[1]("a,b,c"), results[1]("a,b,c") + b("a,b,c"));
+  }
+
+  // deferred assignment statements, which depend on each other
+  typename F::TArray t, u;
+  {
+    expressions::ExprBatch batch;
+    {
+      auto deferral = batch.defer();
+      t("i,j") = a("i,b,c") * b("j,b,c");
+      u("j,i") = 2 * t("i,j");
+      t("i,j") += t("i,j");
+    }
+    BOOST_CHECK_EQUAL(batch.size(), 3ul);
+    BOOST_REQUIRE_NO_THROW(batch.wait());
+  }
+
+  std::vector<typename F::TArray> references(3);
+  references[0]("i,j") = a("i,b,c") * b("j,b,c");
+  references[1]("a,b,c") = a("a,b,c") - b("a,b,c") + b("a,b,c");
+  references[2]("j,i") = 2 * references[0]("i,j");
+  typename F::TArray t_reference;
+  t_reference("i,j") = 2 * references[0]("i,j");
+  results.push_back(u);
+  references.push_back(references[2]);
+  results.push_back(t);
+  references.push_back(t_reference);
+  for (std::size_t r = 0ul; r < results.size(); ++r) {
+    const auto& result = results[r];
+    const auto& reference = references[r];
+    for (std::size_t ord = 0ul; ord < reference.size(); ++ord) {
+      BOOST_CHECK_EQUAL(result.is_zero(ord), reference.is_zero(ord));
+      if (result.is_zero(ord) || !result.is_local(ord)) continue;
+      const auto tile = result.find(ord).get();
+      const auto ref_tile = reference.find(ord).get();
+      for (std::size_t i = 0ul; i < tile.size(); ++i)
+        BOOST_CHECK_EQUAL(tile[i], ref_tile[i]);
+    }
+  }
+}
+
+BOOST_FIXTURE_TEST_CASE_TEMPLATE(dry_run, F, Fixtures, F) {
+  auto& a = F::a;
+  auto& b = F::b;
+  auto& w = F::w;
+
+  auto check_shape = [](const auto& shape, const typename F::TArray& result) {
+    for (std::size_t ord = 0ul; ord < result.size(); ++ord)
+      BOOST_CHECK_EQUAL(shape.is_zero(ord), result.is_zero(ord));
+  };
+
+  // element-wise operations do one operation per result element
+  auto cost = (a("a,b,c") + b("a,b,c")).dry_run(w("a,b,c"));
+  w("a,b,c") = a("a,b,c") + b("a,b,c");
+  check_shape(cost.shape, w);
+  double flops = 0.0;
+  for (std::size_t ord = 0ul; ord < w.size(); ++ord)
+    if (!w.is_zero(ord)) flops += w.trange().make_tile_range(ord).volume();
+  BOOST_CHECK_EQUAL(cost.flops, flops);
+  BOOST_CHECK_EQUAL(cost.memory.size(), std::size_t(w.world().size()));
+  BOOST_CHECK_EQUAL(cost.bcast_bytes, 0ul);
+
+  // contractions do a multiply-add for each product of non-zero tiles
+  cost = (a("i,b,c") * b("j,b,c")).dry_run(w("i,j"));
+  w("i,j") = a("i,b,c") * b("j,b,c");
+  check_shape(cost.shape, w);
+  flops = 0.0;
+  for (const auto& a_idx : a.trange().tiles_range()) {
+    if (a.is_zero(a_idx)) continue;
+    for (const auto& b_idx : b.trange().tiles_range()) {
+      if (a_idx[1] != b_idx[1] || a_idx[2] != b_idx[2] || b.is_zero(b_idx))
+        continue;
+      const auto j_tile = b.trange().dim(0).tile(b_idx[0]);
+      flops += 2.0 * a.trange().make_tile_range(a_idx).volume() *
+               (j_tile.second - j_tile.first);
+    }
+  }
+  BOOST_CHECK_CLOSE(cost.flops, flops, 1e-10);
+  if (w.world().size() == 1) {
+    BOOST_CHECK_EQUAL(cost.bcast_bytes, 0ul);
+    // the result tiles are held in addition to any permuted arguments
+    std::size_t memory = 0ul;
+    for (std::size_t ord = 0ul; ord < w.size(); ++ord)
+      if (!w.is_zero(ord))
+        memory += w.trange().make_tile_range(ord).volume() *
+                  sizeof(typename F::TArray::numeric_type);
+    BOOST_CHECK_GE(cost.peak_memory(), memory);
+  }
+}
+
 BOOST_FIXTURE_TEST_CASE_TEMPLATE(cont_non_uniform1, F, Fixtures, F) {
   // Construct the tiled range
   std::array<std::size_t, 6> tiling1 = {{0, 1, 2, 3, 4, 5}};
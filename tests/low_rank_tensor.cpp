@@ -0,0 +1,194 @@
+/*
+ *  This file is a part of TiledArray.
+ *  Copyright (C) 2026  Virginia Tech
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *  low_rank_tensor.cpp
+ *  October 19, 2026
+ *
+ */
+
+#include "TiledArray/tensor/low_rank_tensor.h"
+#include "tiledarray.h"
+#include "unit_test_config.h"
+
+using TiledArray::LowRankTensor;
+using TiledArray::Permutation;
+using TiledArray::Range;
+using TiledArray::Tensor;
+using TiledArray::math::GemmHelper;
+
+struct LowRankTensorFixture {
+  typedef LowRankTensor<double> LRT;
+  typedef LRT::matrix_type matrix_type;
+
+  LowRankTensorFixture()
+      : a(make_dense(m, n, 5)),
+        b(make_dense(m, n, 3)),
+        c(make_dense(n, k, 4)),
+        lr_a(a, tolerance),
+        lr_b(b, tolerance),
+        lr_c(c, tolerance) {}
+
+  ~LowRankTensorFixture() {}
+
+  // makes a dense m x n tensor with rank r
+  static Tensor<double> make_dense(const std::size_t m, const std::size_t n,
+                                   const std::size_t r) {
+    const matrix_type x = matrix_type::Random(m, r);
+    const matrix_type y = matrix_type::Random(r, n);
+    Tensor<double> result(Range(m, n));
+    for (std::size_t i = 0ul; i < m; ++i)
+      for (std::size_t j = 0ul; j < n; ++j) result(i, j) = (x * y)(i, j);
+    return result;
+  }
+
+  // maximum absolute difference between the elements of t and reference
+  static double max_diff(const LRT& t, const Tensor<double>& reference) {
+    const auto dense = static_cast<Tensor<double>>(t);
+    BOOST_REQUIRE_EQUAL(dense.range(), reference.range());
+    return (dense - reference).abs_max();
+  }
+
+  static constexpr std::size_t m = 20, n = 30, k = 25;
+  static constexpr double tolerance = 1.0e-10;
+  Tensor<double> a, b, c;
+  LRT lr_a, lr_b, lr_c;
+};  // LowRankTensorFixture
+
+BOOST_FIXTURE_TEST_SUITE(low_rank_tensor_suite, LowRankTensorFixture,
+                         TA_UT_LABEL_SERIAL)
+
+BOOST_AUTO_TEST_CASE(default_constructor) {
+  BOOST_REQUIRE_NO_THROW(LRT t);
+  LRT t;
+  BOOST_CHECK(t.empty());
+  BOOST_CHECK_EQUAL(t.size(), 0ul);
+}
+
+BOOST_AUTO_TEST_CASE(compress) {
+  // the compressed rank is the numerical rank of the tile
+  BOOST_CHECK_EQUAL(lr_a.rank(), 5);
+  BOOST_CHECK_EQUAL(lr_b.rank(), 3);
+  BOOST_CHECK_EQUAL(lr_c.rank(), 4);
+  BOOST_CHECK_EQUAL(lr_a.range(), a.range());
+  BOOST_CHECK_EQUAL(lr_a.size(), m * n);
+  BOOST_CHECK_EQUAL(lr_a.tolerance(), tolerance);
+  BOOST_CHECK_SMALL(max_diff(lr_a, a), 1.0e-10);
+
+  // a loose tolerance truncates the rank
+  LRT loose(a, 0.5 * a.norm());
+  BOOST_CHECK_LT(loose.rank(), 5);
+  BOOST_CHECK_LE(
+      (static_cast<Tensor<double>>(loose) - a).norm(), 0.5 * a.norm());
+}
+
+BOOST_AUTO_TEST_CASE(clone) {
+  LRT t = lr_a.clone();
+  BOOST_CHECK_NE(t.u().data(), lr_a.u().data());
+  BOOST_CHECK_SMALL(max_diff(t, a), 1.0e-10);
+}
+
+BOOST_AUTO_TEST_CASE(permute) {
+  Permutation perm({1, 0});
+  LRT t = lr_a.permute(perm);
+  BOOST_CHECK_EQUAL(t.rank(), lr_a.rank());
+  BOOST_CHECK_SMALL(max_diff(t, a.permute(perm)), 1.0e-10);
+}
+
+BOOST_AUTO_TEST_CASE(scale) {
+  BOOST_CHECK_SMALL(max_diff(lr_a.scale(3.0), a.scale(3.0)), 1.0e-10);
+  BOOST_CHECK_SMALL(max_diff(lr_a.neg(), a.neg()), 1.0e-10);
+
+  LRT t = lr_a.clone();
+  t.scale_to(3.0);
+  BOOST_CHECK_SMALL(max_diff(t, a.scale(3.0)), 1.0e-10);
+}
+
+BOOST_AUTO_TEST_CASE(add) {
+  LRT t = lr_a.add(lr_b);
+  BOOST_CHECK_LE(t.rank(), lr_a.rank() + lr_b.rank());
+  BOOST_CHECK_SMALL(max_diff(t, a.add(b)), 1.0e-10);
+  BOOST_CHECK_SMALL(max_diff(lr_a.add(lr_b, 2.0), a.add(b, 2.0)), 1.0e-10);
+
+  // adding a tile to itself does not increase the rank
+  BOOST_CHECK_EQUAL(lr_a.add(lr_a).rank(), lr_a.rank());
+
+  t = lr_a.clone();
+  t.add_to(lr_b);
+  BOOST_CHECK_SMALL(max_diff(t, a.add(b)), 1.0e-10);
+}
+
+BOOST_AUTO_TEST_CASE(subt) {
+  BOOST_CHECK_SMALL(max_diff(lr_a.subt(lr_b), a.subt(b)), 1.0e-10);
+
+  // the difference of a tile with itself is compressed to rank 0
+  LRT t = lr_a.clone();
+  t.subt_to(lr_a);
+  BOOST_CHECK_EQUAL(t.rank(), 0);
+  BOOST_CHECK_SMALL(t.norm(), 1.0e-10);
+}
+
+BOOST_AUTO_TEST_CASE(gemm) {
+  const auto NoT = TiledArray::math::blas::NoTranspose;
+  const auto T = TiledArray::math::blas::Transpose;
+
+  GemmHelper gemm_nn(NoT, NoT, 2u, 2u, 2u);
+  LRT t = lr_a.gemm(lr_c, 3.0, gemm_nn);
+  BOOST_CHECK_LE(t.rank(), std::min(lr_a.rank(), lr_c.rank()));
+  BOOST_CHECK_SMALL(max_diff(t, a.gemm(c, 3.0, gemm_nn)), 1.0e-10);
+
+  GemmHelper gemm_tn(T, NoT, 2u, 2u, 2u);
+  BOOST_CHECK_SMALL(max_diff(lr_a.gemm(lr_b, 1.0, gemm_tn),
+                             a.gemm(b, 1.0, gemm_tn)),
+                    1.0e-10);
+
+  // accumulate into an empty and into a non-empty tile
+  LRT result;
+  result.gemm(lr_a, lr_c, 1.0, gemm_nn);
+  result.gemm(lr_b, lr_c, 1.0, gemm_nn);
+  BOOST_CHECK_LE(result.rank(), lr_c.rank());
+  BOOST_CHECK_SMALL(max_diff(result, a.add(b).gemm(c, 1.0, gemm_nn)),
+                    1.0e-10);
+}
+
+BOOST_AUTO_TEST_CASE(reductions) {
+  BOOST_CHECK_CLOSE(lr_a.squared_norm(), a.squared_norm(), 1.0e-8);
+  BOOST_CHECK_CLOSE(lr_a.norm(), a.norm(), 1.0e-8);
+  BOOST_CHECK_CLOSE(lr_a.sum(), a.sum(), 1.0e-8);
+  BOOST_CHECK_CLOSE(lr_a.dot(lr_b), a.dot(b), 1.0e-8);
+}
+
+BOOST_AUTO_TEST_CASE(serialization) {
+  std::size_t buf_size = 10000;
+  unsigned char* buf = new unsigned char[buf_size];
+  madness::archive::BufferOutputArchive oar(buf, buf_size);
+  BOOST_REQUIRE_NO_THROW(oar & lr_a);
+  std::size_t nbyte = oar.size();
+  oar.close();
+
+  LRT t;
+  madness::archive::BufferInputArchive iar(buf, nbyte);
+  BOOST_REQUIRE_NO_THROW(iar & t);
+  iar.close();
+  delete[] buf;
+
+  BOOST_CHECK_EQUAL(t.range(), lr_a.range());
+  BOOST_CHECK_EQUAL(t.rank(), lr_a.rank());
+  BOOST_CHECK_EQUAL(t.tolerance(), lr_a.tolerance());
+  BOOST_CHECK_SMALL(max_diff(t, a), 1.0e-10);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
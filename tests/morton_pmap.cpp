@@ -0,0 +1,136 @@
+/*
+ *  This file is a part of TiledArray.
+ *  Copyright (C) 2026  Virginia Tech
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "TiledArray/pmap/morton_pmap.h"
+#include "global_fixture.h"
+#include "tiledarray.h"
+#include "unit_test_config.h"
+
+using namespace TiledArray;
+
+struct MortonPmapFixture {
+  MortonPmapFixture() {}
+};
+
+// =============================================================================
+// MortonPmap Test Suite
+
+BOOST_FIXTURE_TEST_SUITE(morton_pmap_suite, MortonPmapFixture)
+
+BOOST_AUTO_TEST_CASE(constructor) {
+  for (std::size_t rows = 1ul; rows < 10ul; ++rows) {
+    for (std::size_t cols = 1ul; cols < 10ul; ++cols) {
+      const std::array<std::size_t, 2> extents = {{rows, cols}};
+      BOOST_REQUIRE_NO_THROW(
+          TiledArray::detail::MortonPmap pmap(*GlobalFixture::world, extents));
+      TiledArray::detail::MortonPmap pmap(*GlobalFixture::world, extents);
+      BOOST_CHECK_EQUAL(pmap.rank(), GlobalFixture::world->rank());
+      BOOST_CHECK_EQUAL(pmap.procs(), GlobalFixture::world->size());
+      BOOST_CHECK_EQUAL(pmap.size(), rows * cols);
+    }
+  }
+}
+
+BOOST_AUTO_TEST_CASE(owner) {
+  const std::size_t rank = GlobalFixture::world->rank();
+  const std::size_t size = GlobalFixture::world->size();
+
+  ProcessID* p_owner = new ProcessID[size];
+
+  // Check various pmap sizes and ranks
+  for (std::size_t n = 1ul; n < 8ul; ++n) {
+    const std::array<std::size_t, 3> extents = {{n, n + 1ul, 3ul}};
+    TiledArray::detail::MortonPmap pmap(*GlobalFixture::world, extents);
+
+    for (std::size_t tile = 0; tile < pmap.size(); ++tile) {
+      std::fill_n(p_owner, size, 0);
+      p_owner[rank] = pmap.owner(tile);
+      // check that the value is in range
+      BOOST_CHECK_LT(p_owner[rank], size);
+      GlobalFixture::world->gop.sum(p_owner, size);
+
+      // Make sure everyone agrees on who owns what.
+      for (std::size_t p = 0ul; p < size; ++p)
+        BOOST_CHECK_EQUAL(p_owner[p], p_owner[rank]);
+    }
+  }
+
+  delete[] p_owner;
+}
+
+BOOST_AUTO_TEST_CASE(locality) {
+  // a 4x4 grid of tiles on 4 processes is split into 2x2 quadrants
+  World& world = *GlobalFixture::world;
+  if (world.size() != 4) return;
+  const std::array<std::size_t, 2> extents = {{4ul, 4ul}};
+  TiledArray::detail::MortonPmap pmap(world, extents);
+  for (std::size_t i = 0ul; i < 4ul; ++i)
+    for (std::size_t j = 0ul; j < 4ul; ++j)
+      BOOST_CHECK_EQUAL(pmap.owner(i * 4ul + j), (i / 2ul) * 2ul + j / 2ul);
+}
+
+BOOST_AUTO_TEST_CASE(local_size) {
+  for (std::size_t rows = 1ul; rows < 10ul; ++rows) {
+    for (std::size_t cols = 1ul; cols < 10ul; ++cols) {
+      const std::array<std::size_t, 2> extents = {{rows, cols}};
+      TiledArray::detail::MortonPmap pmap(*GlobalFixture::world, extents);
+
+      std::size_t total_size = pmap.local_size();
+      GlobalFixture::world->gop.sum(total_size);
+
+      // Check that the total number of elements in all local groups is equal
+      // to the number of tiles in the map, and that the load is balanced.
+      BOOST_CHECK_EQUAL(total_size, rows * cols);
+      BOOST_CHECK_LE(pmap.local_size(),
+                     (rows * cols + pmap.procs() - 1ul) / pmap.procs());
+      BOOST_CHECK(pmap.empty() == (pmap.local_size() == 0ul));
+    }
+  }
+}
+
+BOOST_AUTO_TEST_CASE(local_group) {
+  ProcessID tile_owners[100];
+
+  for (std::size_t rows = 1ul; rows < 10ul; ++rows) {
+    for (std::size_t cols = 1ul; cols < 10ul; ++cols) {
+      const std::array<std::size_t, 2> extents = {{rows, cols}};
+      TiledArray::detail::MortonPmap pmap(*GlobalFixture::world, extents);
+      const std::size_t tiles = pmap.size();
+
+      // Check that all local elements map to this rank
+      for (detail::MortonPmap::const_iterator it = pmap.begin();
+           it != pmap.end(); ++it) {
+        BOOST_CHECK_EQUAL(pmap.owner(*it), GlobalFixture::world->rank());
+      }
+
+      std::fill_n(tile_owners, tiles, 0);
+      for (detail::MortonPmap::const_iterator it = pmap.begin();
+           it != pmap.end(); ++it) {
+        tile_owners[*it] += GlobalFixture::world->rank();
+      }
+
+      GlobalFixture::world->gop.sum(tile_owners, tiles);
+      for (std::size_t tile = 0; tile < tiles; ++tile) {
+        BOOST_CHECK_EQUAL(tile_owners[tile], pmap.owner(tile));
+      }
+    }
+  }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -26,6 +26,14 @@ BOOST_AUTO_TEST_CASE(retile_tensor) {
 
     BOOST_CHECK_EQUAL(result_dense.trange(), trange);
     BOOST_CHECK_EQUAL(result_sparse.trange(), trange);
+
+    // the elements are unchanged
+    for (auto&& result : {result_dense, TA::to_dense(result_sparse)}) {
+      auto tile = result.find({1, 0}).get();
+      BOOST_CHECK_EQUAL(tile.range().lobound()[0], 3);
+      BOOST_CHECK_EQUAL(tile(3, 0), 1.6);
+      BOOST_CHECK_EQUAL(tile(4, 3), 2.4);
+    }
 }
 
 BOOST_AUTO_TEST_SUITE_END()
\ No newline at end of file
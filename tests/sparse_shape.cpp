@@ -750,6 +750,29 @@ BOOST_AUTO_TEST_CASE(mask) {
                     tolerance);
 }
 
+BOOST_AUTO_TEST_CASE(truncate) {
+  // truncate at a threshold above the initial one
+  const float thresh = 2.f * sparse_shape.init_threshold() + 1.f;
+
+  SparseShape<float> result;
+  BOOST_REQUIRE_NO_THROW(result = sparse_shape.truncate(thresh));
+  BOOST_CHECK_EQUAL(result.init_threshold(), thresh);
+
+  size_type zero_tile_count = 0ul;
+  for (Tensor<float>::size_type i = 0ul; i < tr.tiles_range().volume(); ++i) {
+    const float expected = sparse_shape[i] < thresh ? 0.f : sparse_shape[i];
+    BOOST_CHECK_EQUAL(result[i], expected);
+    BOOST_CHECK_EQUAL(result.is_zero(i), sparse_shape[i] < thresh);
+    if (result.is_zero(i)) ++zero_tile_count;
+  }
+
+  BOOST_CHECK_EQUAL(result.nnz(),
+                    tr.tiles_range().volume() - zero_tile_count);
+  BOOST_CHECK_CLOSE(result.sparsity(),
+                    float(zero_tile_count) / float(tr.tiles_range().volume()),
+                    tolerance);
+}
+
 BOOST_AUTO_TEST_CASE(scale) {
   // change default threshold to make sure it's not inherited
   auto resetter = set_threshold_to_max();
@@ -0,0 +1,110 @@
+/*
+ *  This file is a part of TiledArray.
+ *  Copyright (C) 2026  Virginia Tech
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *  symm_storage.cpp
+ *  October 19, 2026
+ *
+ */
+
+#include <tiledarray.h>
+#include "TiledArray/symm/symmetric_storage.h"
+#include "unit_test_config.h"
+
+using TiledArray::symmetry::PermutationalSymmetry;
+
+struct SymmStorageFixture {
+  SymmStorageFixture()
+      : tr_o(TA::TiledRange1{0, 2, 5, 6}),
+        tr_v(TA::TiledRange1{0, 3, 4, 8, 10}),
+        sym(PermutationalSymmetry().antisymmetric({0, 1}).antisymmetric(
+            {2, 3})) {}
+
+  /// A random array that is antisymmetric in {0,1} and in {2,3}
+  TA::TSpArrayD antisymmetric(const TA::TiledRange1& tr0,
+                              const TA::TiledRange1& tr1) {
+    TA::TSpArrayD r(*GlobalFixture::world, TA::TiledRange{tr0, tr0, tr1, tr1});
+    r.fill_random();
+    TA::TSpArrayD result;
+    result("i,j,a,b") = r("i,j,a,b") - r("j,i,a,b") - r("i,j,b,a") +
+                        r("j,i,b,a");
+    return result;
+  }
+
+  TA::TiledRange1 tr_o;
+  TA::TiledRange1 tr_v;
+  PermutationalSymmetry sym;
+};  // SymmStorageFixture
+
+BOOST_FIXTURE_TEST_SUITE(symm_storage_suite, SymmStorageFixture,
+                         TA_UT_LABEL_SERIAL)
+
+BOOST_AUTO_TEST_CASE(canonical) {
+  // 3 modes, antisymmetric
+  auto sym3 = PermutationalSymmetry().antisymmetric({0, 1, 2});
+  BOOST_CHECK(sym3.is_unique(std::vector<int>{0, 1, 1}));
+  BOOST_CHECK(!sym3.is_unique(std::vector<int>{1, 0, 1}));
+
+  auto [c, p, sign] = sym3.canonical(std::vector<int>{2, 0, 1});
+  BOOST_CHECK((c == TA::Range::index_type{0, 1, 2}));
+  BOOST_CHECK_EQUAL(sign, 1);
+  BOOST_CHECK_EQUAL(p, TA::Permutation({1, 2, 0}));
+
+  auto [c2, p2, sign2] = sym3.canonical(std::vector<int>{0, 2, 1});
+  BOOST_CHECK((c2 == TA::Range::index_type{0, 1, 2}));
+  BOOST_CHECK_EQUAL(sign2, -1);
+  BOOST_CHECK_EQUAL(p2, TA::Permutation({0, 2, 1}));
+
+  const PermutationalSymmetry::modes_type all{0, 1, 2};
+  BOOST_CHECK_EQUAL(sym3.orbit_size(std::vector<int>{0, 1, 2}, all), 6ul);
+  BOOST_CHECK_EQUAL(sym3.orbit_size(std::vector<int>{0, 1, 1}, all), 3ul);
+  BOOST_CHECK_EQUAL(sym3.orbit_size(std::vector<int>{1, 1, 1}, all), 1ul);
+  BOOST_CHECK_EQUAL(sym.orbit_size(std::vector<int>{0, 1, 0, 1}, {2, 3}), 2ul);
+  BOOST_CHECK_EQUAL(sym.orbit_size(std::vector<int>{0, 1, 0, 1}, {0, 1, 2, 3}),
+                    4ul);
+}
+
+BOOST_AUTO_TEST_CASE(pack_unpack) {
+  auto t = antisymmetric(tr_o, tr_v);
+
+  TA::TSpArrayD t_p;
+  BOOST_REQUIRE_NO_THROW(t_p = TiledArray::symmetry::pack(t, sym));
+  BOOST_CHECK_EQUAL(t_p.trange(), t.trange());
+  for (auto&& idx : t_p.trange().tiles_range())
+    BOOST_CHECK_EQUAL(t_p.is_zero(idx), !sym.is_unique(idx) || t.is_zero(idx));
+
+  TA::TSpArrayD t_u;
+  BOOST_REQUIRE_NO_THROW(t_u = TiledArray::symmetry::unpack(t_p, sym));
+  BOOST_CHECK_SMALL((t_u("i,j,a,b") - t("i,j,a,b")).norm().get(), 1e-10);
+}
+
+BOOST_AUTO_TEST_CASE(contraction) {
+  auto t = antisymmetric(tr_o, tr_v);
+  auto v = antisymmetric(tr_v, tr_v);
+  TA::TSpArrayD r;
+  r("i,j,a,b") = t("i,j,c,d") * v("c,d,a,b");
+
+  auto t_p = TiledArray::symmetry::pack(t, sym);
+  auto v_p = TiledArray::symmetry::pack(v, sym);
+  TA::TSpArrayD r_p;
+  r_p("i,j,a,b") =
+      TiledArray::symmetry::orbit_weighted(t_p, sym, {2, 3})("i,j,c,d") *
+      v_p("c,d,a,b");
+  auto r_u = TiledArray::symmetry::unpack(r_p, sym);
+  BOOST_CHECK_SMALL((r_u("i,j,a,b") - r("i,j,a,b")).norm().get(), 1e-10);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -24,6 +24,7 @@
 
 #include <iterator>
 #include "TiledArray/math/gemm_helper.h"
+#include "TiledArray/math/simd.h"
 #include "TiledArray/tensor.h"
 #include "tensor_fixture.h"
 #include "tiledarray.h"
@@ -724,4 +725,110 @@ BOOST_AUTO_TEST_CASE(block) {
 #endif
 }
 
+BOOST_AUTO_TEST_CASE(simd_kernels) {
+  auto check = [](auto zero) {
+    using T = decltype(zero);
+    const T tol = std::is_same_v<T, float> ? T(1e-3) : T(1e-10);
+    for (std::size_t n : {0ul, 1ul, 3ul, 8ul, 17ul, 64ul, 257ul}) {
+      // an offset of one element makes the data misaligned
+      for (std::size_t offset : {0ul, 1ul}) {
+        std::vector<T> xbuf(n + offset), ybuf(n + offset);
+        for (std::size_t i = 0ul; i < n + offset; ++i) {
+          xbuf[i] = T(GlobalFixture::world->rand() % 101) / T(7) - T(5);
+          ybuf[i] = T(GlobalFixture::world->rand() % 101) / T(11) - T(3);
+        }
+        const T* x = xbuf.data() + offset;
+        std::vector<T> y0(ybuf.begin() + offset, ybuf.end());
+
+        auto y = y0;
+        TiledArray::math::simd::scale(n, T(3), y.data());
+        for (std::size_t i = 0ul; i < n; ++i)
+          BOOST_CHECK_EQUAL(y[i], T(3) * y0[i]);
+
+        y = y0;
+        TiledArray::math::simd::axpy(n, T(2), x, y.data());
+        for (std::size_t i = 0ul; i < n; ++i)
+          BOOST_CHECK_CLOSE_FRACTION(y[i], y0[i] + T(2) * x[i], tol);
+
+        y = y0;
+        TiledArray::math::simd::add(n, x, y.data());
+        for (std::size_t i = 0ul; i < n; ++i)
+          BOOST_CHECK_EQUAL(y[i], y0[i] + x[i]);
+
+        y = y0;
+        TiledArray::math::simd::subt(n, x, y.data());
+        for (std::size_t i = 0ul; i < n; ++i)
+          BOOST_CHECK_EQUAL(y[i], y0[i] - x[i]);
+
+        y = y0;
+        TiledArray::math::simd::mult(n, x, y.data());
+        for (std::size_t i = 0ul; i < n; ++i)
+          BOOST_CHECK_EQUAL(y[i], y0[i] * x[i]);
+
+        T dot = 0, norm2 = 0, amax = 0;
+        for (std::size_t i = 0ul; i < n; ++i) {
+          dot += x[i] * y0[i];
+          norm2 += x[i] * x[i];
+          amax = std::max(amax, std::abs(x[i]));
+        }
+        BOOST_CHECK_SMALL(
+            TiledArray::math::simd::dot(n, x, y0.data()) - dot,
+            tol * (T(1) + std::abs(dot)));
+        BOOST_CHECK_SMALL(TiledArray::math::simd::squared_norm(n, x) - norm2,
+                          tol * (T(1) + norm2));
+        BOOST_CHECK_EQUAL(TiledArray::math::simd::abs_max(n, x), amax);
+      }
+    }
+  };
+  check(0.0);
+  check(0.0f);
+}
+
+BOOST_AUTO_TEST_CASE(intra_tile_parallel) {
+  // split even small tiles among the idle threads
+  const auto min_volume = TiledArray::intra_tile_min_volume;
+  TiledArray::intra_tile_min_volume = 16ul;
+
+  const std::array<std::size_t, 4> start = {{0ul, 0ul, 0ul, 0ul}};
+  const std::array<std::size_t, 4> finish = {{3ul, 5ul, 7ul, 11ul}};
+  TensorN x(range_type(start, finish));
+  rand_fill(1693, x.size(), x.data());
+
+  std::array<unsigned int, 4> p = {{0, 1, 2, 3}};
+  while (std::next_permutation(p.begin(), p.end())) {
+    Permutation perm(p.begin(), p.end());
+    TensorN px(x, perm);
+    for (std::size_t i = 0ul; i < x.size(); ++i) {
+      std::size_t pi = px.range().ordinal(perm * x.range().idx(i));
+      BOOST_CHECK_EQUAL(px[pi], x[i]);
+    }
+  }
+
+  TensorD a(x.range()), b(x.range());
+  for (std::size_t i = 0ul; i < x.size(); ++i) {
+    a[i] = x[i];
+    b[i] = 2 * x[i] + 1;
+  }
+  TensorD c = a.add(b);
+  double norm2 = 0;
+  for (std::size_t i = 0ul; i < x.size(); ++i) {
+    BOOST_CHECK_EQUAL(c[i], a[i] + b[i]);
+    norm2 += c[i] * c[i];
+  }
+  BOOST_CHECK_CLOSE(c.squared_norm(), norm2, 1e-10);
+
+  // tile operations that run concurrently in tasks split their ranges too
+  std::vector<madness::Future<TensorD>> sums;
+  for (int i = 0; i < 8; ++i)
+    sums.push_back(
+        GlobalFixture::world->taskq.add([a, b]() { return a.add(b); }));
+  for (auto& sum : sums) {
+    const TensorD d = sum.get();
+    for (std::size_t i = 0ul; i < x.size(); ++i)
+      BOOST_CHECK_EQUAL(d[i], c[i]);
+  }
+
+  TiledArray::intra_tile_min_volume = min_volume;
+}
+
 BOOST_AUTO_TEST_SUITE_END()
@@ -219,6 +219,45 @@ BOOST_AUTO_TEST_CASE(matrix_multiply) {
   BOOST_CHECK_EQUAL(result_map, C);
 }
 
+BOOST_AUTO_TEST_CASE(mixed_precision_matrix_multiply) {
+  const std::size_t m = 18, n = 36, k = 1000;
+
+  // Construct single-precision arguments with terms of mixed magnitude: every
+  // third product is ~2^20 times larger than the others, so a sum of k terms
+  // exceeds the float mantissa, while it is exact in double precision
+  TensorF left(TensorF::range_type(m, k)), right(TensorF::range_type(k, n));
+  for (std::size_t i = 0ul; i < m; ++i)
+    for (std::size_t p = 0ul; p < k; ++p) left(i, p) = float(i + 1ul);
+  for (std::size_t p = 0ul; p < k; ++p)
+    for (std::size_t j = 0ul; j < n; ++j)
+      right(p, j) = (p % 3ul == 0ul ? float(1ul << 20) : float(j + 1ul));
+
+  // Contract into a double-precision result, twice to test accumulation
+  ContractReduce<TensorD, TensorF, TensorF, double> op(
+      TiledArray::math::blas::Op::NoTrans, TiledArray::math::blas::Op::NoTrans,
+      3, 2u, 2u, 2u);
+  TensorD result;
+  BOOST_REQUIRE_NO_THROW(op(result, left, right));
+  BOOST_REQUIRE_NO_THROW(op(result, left, right));
+  BOOST_CHECK_EQUAL(result.range(), TensorD::range_type(m, n));
+
+  // Compute reference values in double precision and compare to the result;
+  // check that accumulating in single precision would give other values
+  std::size_t differences = 0ul;
+  for (std::size_t i = 0ul; i < m; ++i)
+    for (std::size_t j = 0ul; j < n; ++j) {
+      double c = 0.0;
+      float c_f = 0.0f;
+      for (std::size_t p = 0ul; p < k; ++p) {
+        c += double(left(i, p)) * double(right(p, j));
+        c_f += left(i, p) * right(p, j);
+      }
+      if (double(c_f) != c) ++differences;
+      BOOST_CHECK_EQUAL(result(i, j), 6.0 * c);
+    }
+  BOOST_REQUIRE_GT(differences, 0ul);
+}
+
 BOOST_AUTO_TEST_CASE(tensor_contract1) {
   // Set dimension constants
   const std::size_t left_outer_start = 2, left_outer_finish = 20,
@@ -29,6 +29,7 @@
 #include "unit_test_config.h"
 
 using namespace TiledArray;
+using TiledArray::detail::ReleasableScal;
 using TiledArray::detail::Scal;
 
 struct ScalFixture : public RangeFixture {
@@ -148,4 +149,29 @@ BOOST_AUTO_TEST_CASE(unary_scale_perm_consume) {
   }
 }
 
+BOOST_AUTO_TEST_CASE(released_scale) {
+  ReleasableScal<TensorI, TensorI, int, false> scal_op(7, true);
+
+  BOOST_CHECK_NO_THROW(b = scal_op(a));
+
+  // Check that a was cloned, not scaled
+  BOOST_CHECK_NE(b.data(), a.data());
+  for (std::size_t i = 0ul; i < r.volume(); ++i) {
+    BOOST_CHECK_EQUAL(b[i], a[i]);
+  }
+}
+
+BOOST_AUTO_TEST_CASE(released_scale_consume) {
+  ReleasableScal<TensorI, TensorI, int, true> scal_op(7, true);
+  const TensorI ax(a.range(), a.begin());
+
+  BOOST_CHECK_NO_THROW(b = scal_op(a));
+
+  // Check that a was passed through, not scaled
+  BOOST_CHECK_EQUAL(b.data(), a.data());
+  for (std::size_t i = 0ul; i < r.volume(); ++i) {
+    BOOST_CHECK_EQUAL(b[i], ax[i]);
+  }
+}
+
 BOOST_AUTO_TEST_SUITE_END()
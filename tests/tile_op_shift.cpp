@@ -0,0 +1,108 @@
+/*
+ *  This file is a part of TiledArray.
+ *  Copyright (C) 2026  Virginia Tech
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *  tile_op_shift.cpp
+ *  October 19, 2026
+ *
+ */
+
+#include "TiledArray/tile_op/shift.h"
+#include "range_fixture.h"
+#include "tiledarray.h"
+#include "unit_test_config.h"
+
+using namespace TiledArray;
+using TiledArray::detail::Shift;
+
+struct ShiftFixture : public RangeFixture {
+  ShiftFixture()
+      : a(RangeFixture::r), b(), perm({2, 0, 1}), range_shift({-1, -2, -3}) {
+    GlobalFixture::world->srand(27);
+    for (std::size_t i = 0ul; i < r.volume(); ++i) {
+      a[i] = GlobalFixture::world->rand() / 101;
+    }
+  }
+
+  ~ShiftFixture() {}
+
+  Tensor<int> a;
+  Tensor<int> b;
+  Permutation perm;
+  std::vector<long> range_shift;
+
+};  // ShiftFixture
+
+BOOST_FIXTURE_TEST_SUITE(tile_op_shift_suite, ShiftFixture,
+                         TA_UT_LABEL_SERIAL)
+
+BOOST_AUTO_TEST_CASE(constructor) {
+  // Check that the constructors can be called without throwing exceptions
+  BOOST_CHECK_NO_THROW(
+      (Shift<Tensor<int>, Tensor<int>, false>(range_shift)));
+  BOOST_CHECK_NO_THROW((Shift<Tensor<int>, Tensor<int>, true>(range_shift)));
+}
+
+BOOST_AUTO_TEST_CASE(shift) {
+  Shift<Tensor<int>, Tensor<int>, false> shift_op(range_shift);
+  const Range a_range = a.range();
+
+  BOOST_CHECK_NO_THROW(b = shift_op(a));
+
+  // Check that the result range is shifted and the argument is not modified
+  BOOST_CHECK_EQUAL(b.range(), Range(a_range).inplace_shift(range_shift));
+  BOOST_CHECK_EQUAL(a.range(), a_range);
+
+  // Check that a was not consumed, and the result does not share its data
+  BOOST_CHECK_NE(b.data(), a.data());
+
+  // Check that the data in the new tile is correct
+  for (std::size_t i = 0ul; i < r.volume(); ++i) {
+    BOOST_CHECK_EQUAL(b[i], a[i]);
+  }
+}
+
+BOOST_AUTO_TEST_CASE(shift_perm) {
+  Shift<Tensor<int>, Tensor<int>, false> shift_op(range_shift);
+
+  BOOST_CHECK_NO_THROW(b = shift_op(a, perm));
+
+  // Check that the result range is permuted and shifted
+  BOOST_CHECK_EQUAL(b.range(),
+                    Range(perm * a.range()).inplace_shift(range_shift));
+
+  // Check that a was not consumed
+  BOOST_CHECK_NE(b.data(), a.data());
+
+  // Check that the data in the new tile is correct
+  for (std::size_t i = 0ul; i < r.volume(); ++i) {
+    BOOST_CHECK_EQUAL(b[i], a.permute(perm)[i]);
+  }
+}
+
+BOOST_AUTO_TEST_CASE(shift_consume) {
+  Shift<Tensor<int>, Tensor<int>, true> shift_op(range_shift);
+  const Range a_range = a.range();
+  const auto* a_data = a.data();
+
+  BOOST_CHECK_NO_THROW(b = shift_op(a));
+
+  // Check that the result range is shifted and the data was not copied
+  BOOST_CHECK_EQUAL(b.range(), Range(a_range).inplace_shift(range_shift));
+  BOOST_CHECK_EQUAL(b.data(), a_data);
+}
+
+BOOST_AUTO_TEST_SUITE_END()